@@ -1207,6 +1207,7 @@ AC_SUBST([am__untar])
 m4_include([m4/ax_append_compile_flags.m4])
 m4_include([m4/ax_append_flag.m4])
 m4_include([m4/ax_arg_enable_assert.m4])
+m4_include([m4/ax_arg_enable_epoll.m4])
 m4_include([m4/ax_arg_enable_warnings.m4])
 m4_include([m4/ax_arg_openssl.m4])
 m4_include([m4/ax_check_compile_flag.m4])
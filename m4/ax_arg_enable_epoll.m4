@@ -0,0 +1,8 @@
+AC_DEFUN([AX_ARG_ENABLE_EPOLL],[
+  AC_ARG_ENABLE(epoll, AS_HELP_STRING([--disable-epoll],
+                                      [Use poll() instead of epoll() for scanner I/O]),
+    [epoll=$enableval], [epoll=yes])
+
+  AS_IF([test "$epoll" = "yes"],
+    [AC_CHECK_HEADERS(sys/epoll.h)])
+])
@@ -355,8 +355,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 107
-#define YY_END_OF_BUFFER 108
+#define YY_NUM_RULES 119
+#define YY_END_OF_BUFFER 120
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -364,59 +364,69 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[467] =
+static const flex_int16_t yy_accept[552] =
     {   0,
-        7,    7,    0,    0,  108,  106,    7,    6,  106,    8,
-      106,  106,    9,  106,  106,  106,  106,  106,  106,  106,
-      106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
-      106,  106,  106,    3,    4,    3,    7,    6,    0,   10,
-        8,    0,    1,    8,    9,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   25,    0,    0,
-        0,    0,    0,   85,    0,    0,    0,    0,   90,    0,
-        0,    0,    0,    0,    0,  104,    0,  102,    0,    0,
+        7,    7,    0,    0,  120,  118,    7,    6,  118,    8,
+      118,  118,    9,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,    3,    4,    3,    7,    6,    0,
+       10,    8,    0,    1,    8,    9,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   28,
+        0,    0,    0,    0,    0,    0,   97,    0,    0,    0,
+        0,  102,    0,    0,    0,    0,    0,    0,  116,    0,
+      114,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    2,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,   72,    0,
-        0,    0,    0,    0,    0,    0,    0,   29,    0,   31,
+        0,    0,    0,    2,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   84,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   33,    0,   35,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  105,    0,   42,    0,    0,    0,    0,
+      117,    0,   51,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  113,
+        0,    0,    0,   12,    0,    0,   92,    0,    0,    0,
+        0,   83,    0,    0,    0,    0,    0,   29,   86,  103,
+        0,   31,   32,    0,    0,    0,   36,    0,    0,    0,
+
+        0,   38,    0,   39,    0,   47,    0,   50,    0,    0,
+        0,    0,   56,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   70,  112,    0,   72,
+       73,    0,   82,    0,   78,    0,    0,    0,    0,    0,
+       91,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  115,   85,    0,  105,    0,   96,    0,   34,
+        0,  101,    0,    0,   80,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   61,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   75,   81,
+        0,   77,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   27,    0,    0,
+       30,   95,    0,    0,  100,    0,   88,   79,    0,    0,
+       49,    0,    0,    0,    0,    0,    0,    0,    0,  110,
+        0,    0,   90,    0,   65,  107,  108,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   16,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      101,    0,    0,   12,    0,    0,   80,    0,    0,    0,
-       71,    0,    0,    0,    0,    0,   74,   91,    0,   27,
-       28,    0,    0,    0,   32,    0,    0,    0,    0,   34,
-        0,   35,    0,   38,    0,   41,    0,    0,    0,    0,
-
-       47,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  100,   61,   62,    0,   70,    0,
-       66,    0,    0,    0,    0,   79,    0,    0,    0,    0,
-        0,    0,    0,    0,  103,   73,    0,   93,    0,   84,
-        0,   30,    0,   89,    0,    0,   68,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   52,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   64,
-       69,    0,   65,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   24,    0,    0,   26,   83,    0,
-        0,   88,    0,   76,   67,    0,    0,   40,    0,    0,
-
-        0,    0,    0,    0,    0,    0,   98,    0,    0,   78,
-        0,   56,   95,   96,    0,    0,    0,    0,    0,    0,
-        0,    0,   15,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   75,    0,    0,   43,    0,
-       45,   46,    0,    0,    0,    0,   53,   54,   77,    0,
-        0,   60,    0,   97,    0,    0,    0,    0,    0,    0,
-        0,   23,    0,    0,   99,   92,    0,   82,   33,   87,
-       36,   39,   44,   48,    0,   50,    0,   55,    0,    0,
-        0,   63,    0,    0,    0,    0,    0,   14,    0,    0,
-        0,   19,    0,    0,    0,   94,   81,   86,    0,    0,
-
-        0,   57,    0,    0,    0,    5,    0,    5,    0,    0,
-        0,    0,    0,   22,    0,    0,    0,    0,    0,    0,
-        0,    0,   13,    0,    0,    0,   20,   21,    0,   49,
-        0,   58,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   59,   11,    0,    0,
-        0,    0,    0,    0,    0,   18,    0,    0,   16,    0,
-       37,    0,    0,   51,   17,    0
+        0,    0,    0,   87,    0,    0,   52,    0,   54,   55,
+        0,    0,    0,    0,   62,   63,   89,    0,    0,   69,
+        0,    0,  109,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   26,    0,    0,    0,  111,  104,    0,
+
+       94,   37,   99,   40,   48,   53,   57,    0,   59,    0,
+       64,    0,    0,    0,    0,   74,    0,    0,    0,    0,
+        0,    0,   14,   15,    0,    0,    0,    0,   21,    0,
+        0,    0,    0,  106,   93,   98,    0,    0,    0,   66,
+        0,    0,    0,   76,    0,    5,    0,    5,    0,    0,
+        0,    0,    0,    0,   25,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   71,    0,   13,
+        0,    0,    0,    0,   22,   23,    0,    0,    0,    0,
+        0,    0,   58,    0,   67,    0,    0,    0,    0,    0,
+       20,   24,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,   42,    0,    0,    0,    0,    0,
+       68,   11,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   19,    0,    0,    0,    0,    0,    0,
+       17,    0,   41,    0,    0,   45,    0,    0,    0,    0,
+        0,   46,   60,   18,    0,    0,    0,    0,   43,   44,
+        0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -430,11 +440,11 @@ static const YY_CHAR yy_ec[256] =
         1,   14,    1,    1,   15,   16,   17,   18,   19,   20,
        21,   22,   23,    1,   24,   25,   26,   27,   28,   29,
        30,   31,   32,   33,   34,   35,   36,   37,   38,   39,
-        1,    1,    1,    1,   40,    1,   41,   42,   43,   44,
+        1,    1,    1,    1,   40,    1,   15,   16,   17,   18,
 
-       45,   46,   47,   48,   49,    1,   50,   51,   52,   53,
-       54,   55,   56,   57,   58,   59,   60,   61,   62,   63,
-       64,   65,    1,    1,    1,    1,    1,    1,    1,    1,
+       19,   20,   21,   22,   23,    1,   24,   25,   26,   27,
+       28,   29,   30,   31,   32,   33,   34,   35,   36,   37,
+       38,   39,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -451,351 +461,550 @@ static const YY_CHAR yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static const YY_CHAR yy_meta[66] =
+static const YY_CHAR yy_meta[41] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[473] =
+static const flex_int16_t yy_base[552] =
     {   0,
-        0,    0,   63,   64,  920,  921,  917,    0,   68,    0,
-       45,   67,   67,   56,   65,   59,   68,   45,   70,   56,
-       93,  107,  144,  112,  116,  184,   74,  151,  159,   54,
-       69,  128,  119,  921,  921,  910,  915,    0,   93,  921,
-        0,  112,  921,    0,  208,  136,  140,  148,  161,  145,
-      168,  161,  146,  163,  187,  192,  197,  921,  190,  193,
-      192,  193,  213,  193,  196,  210,  213,  207,  202,  221,
-      216,  228,  219,  226,  232,  218,  238,  921,  257,  227,
-      232,  249,  243,  250,  265,  245,  271,  270,  271,  260,
-      266,  261,  267,  279,  271,  284,  280,  296,  921,  293,
-
-      284,  281,  870,  309,  311,  304,  306,  307,  303,  322,
-      324,  314,  310,  312,  315,  323,  132,  921,  314,  921,
-      320,  322,  326,  868,  318,  338,  321,  340,  330,  348,
-      354,  354,  357,  921,  351,  921,  360,  352,  366,  367,
-      355,  357,  373,  364,  369,  362,  369,  371,  382,  366,
-      378,  382,  386,  388,  392,  384,  387,  399,  409,  401,
-      921,  409,  416,  921,  402,  414,  407,  413,  427,  412,
-      921,  419,  426,  421,  419,  431,  419,  423,  420,  921,
-      921,  435,  441,  444,  921,  436,  452,  459,  449,  921,
-      462,  921,  471,  455,  471,  921,  462,  455,  464,  471,
-
-      921,  467,  463,  471,  472,  462,  483,  478,  477,  480,
-      488,  477,  492,  487,  921,  921,  492,  490,  495,  519,
-      504,  504,  507,  513,  517,  921,  524,  517,  527,  867,
-      529,  525,  534,  518,  921,  921,  524,  525,  536,  524,
-      519,  921,  539,  527,  523,  544,  535,  554,  556,  560,
-      559,  560,  559,  566,  575,  571,  580,  569,  921,  567,
-      571,  581,  584,  588,  573,   94,  573,  573,  593,  921,
-      921,  576,  921,  592,  579,  589,  592,  594,  605,  606,
-      611,  613,  614,  614,  921,  611,  618,  921,  921,  614,
-      633,  921,  617,  619,  921,  630,  623,  921,  623,  625,
-
-      632,  640,  632,  635,  636,  644,  921,  644,  636,  639,
-      652,  921,  921,  921,  866,  646,  657,  671,  673,  864,
-      667,  663,  921,  858,  677,  667,  671,  677,  683,  666,
-      671,  674,  688,  690,  691,  921,  692,  677,  921,  695,
-      921,  921,  689,  696,  698,  702,  921,  921,  921,  698,
-      719,  921,  708,  921,  742,  711,  707,  714,  729,  713,
-      726,  921,  730,  730,  921,  921,  727,  731,  921,  732,
-      851,  921,  921,  921,  737,  921,  733,  921,  738,  741,
-      737,  921,  795,  883,  757,  757,  739,  921,  752,  747,
-      760,  921,  761,  771,  766,  921,  921,  921,  771,  769,
-
-      781,  921,  775,  779,  260,  188,  177,  127,  785,  785,
-      781,  796,  790,  921,  784,  785,  800,  788,  795,  790,
-      801,  802,  921,  808,  797,  814,  921,  921,  818,  921,
-      802,  921,  812,  821,  821,  835,  827,  822,  839,  841,
-      825,  829,   97,  832,  844,  837,  921,  921,  854,  838,
-      838,  848,  839,  850,  853,  921,  859,  864,  921,  844,
-      921,  860,  867,  921,  921,  921,  912,  133,  914,  132,
-      100,   97
+       42,   83,  124,  165,    1,  291,  744,  288,  206,  329,
+      777,  814,  740,  830,  770,  761,  782,  883,  846,  796,
+      788,  768,  739,  771,  778,  741,  852,  806,  742,  893,
+      889,  859,  877,  753,  332,  373,  915,  745,  370,  247,
+      414,  411,  903,  455,  452,  792,  821,  918,  922,  924,
+      926,  927,  928,  843,  929,  931,  932,  935,  936,  496,
+      937,  938,  940,  941,  942,  945,  946,  947,  950,  948,
+      863,  952,  953,  955,  872,  957,  958,  964,  956,  960,
+      537,  812,  965,  968,  970,  978,  966,  818,  986,  987,
+      810,  991,  992,  993,  868,  995,  996,  998, 1001, 1003,
+
+     1000,  873, 1004,  578, 1007, 1005, 1006, 1010, 1013, 1014,
+     1012, 1011, 1015, 1016, 1021,  876, 1032, 1026, 1035, 1018,
+     1037, 1042, 1039,  874,  619, 1045,  660, 1046, 1048, 1049,
+     1051, 1054, 1055, 1056, 1057, 1059, 1058, 1063, 1060, 1065,
+      701, 1064,  748, 1066, 1061, 1079, 1081, 1069, 1072,  879,
+     1082, 1083, 1085, 1086, 1094, 1096, 1097, 1100, 1098, 1104,
+     1106, 1107, 1103, 1109, 1111, 1112, 1115, 1116, 1117,  826,
+     1121, 1120, 1127,  885, 1129, 1130, 1133, 1131, 1134, 1136,
+      875, 1495, 1135,  816, 1138, 1141, 1147, 1686, 1149,  881,
+     1152, 1688, 1690, 1153, 1155, 1156, 1691, 1157, 1158, 1162,
+
+     1159, 1692, 1167, 1693, 1168, 1169, 1173, 1694, 1174, 1176,
+     1179, 1180, 1696, 1182, 1184, 1186, 1187, 1191, 1196,  887,
+     1193, 1195, 1197, 1194, 1199, 1200, 1699, 1701, 1204, 1705,
+     1198, 1205, 1208, 1209, 1211, 1206, 1219, 1222, 1223, 1227,
+     1706, 1230, 1232, 1231, 1239, 1236, 1233, 1241, 1234, 1242,
+     1245, 1244, 1708, 1709, 1237, 1247, 1248, 1249, 1262, 1710,
+     1263, 1264, 1266, 1268, 1269, 1271, 1272, 1274, 1275, 1278,
+     1279, 1280, 1286, 1284, 1283, 1285, 1711, 1289, 1290, 1292,
+     1295, 1294, 1297,  898, 1299, 1308, 1314, 1315, 1712, 1713,
+     1316, 1715, 1317, 1321, 1319, 1322, 1324, 1323, 1325, 1326,
+
+     1327, 1331,  901, 1329, 1335, 1334, 1336, 1716, 1338, 1340,
+     1717, 1718, 1341, 1343, 1719, 1345, 1348, 1720, 1353, 1355,
+     1721, 1357, 1359, 1362, 1365, 1366, 1367, 1369, 1372, 1723,
+     1371, 1373, 1376, 1377, 1724, 1725, 1726, 1379, 1381, 1382,
+     1383, 1387, 1398, 1396, 1385, 1399, 1401, 1402, 1727, 1403,
+     1405, 1410, 1407, 1411, 1413, 1412, 1416, 1417, 1418, 1420,
+     1422, 1424, 1427, 1728, 1428, 1423, 1729, 1430, 1730, 1731,
+     1432, 1434, 1440, 1444, 1732, 1733, 1734, 1437,  828, 1735,
+     1449, 1450, 1736, 1455,  840, 1463, 1460, 1464, 1465,  832,
+     1467, 1466, 1468, 1737, 1473, 1472, 1470, 1738, 1739, 1471,
+
+     1474, 1740, 1475, 1476, 1741, 1742, 1743, 1477, 1744, 1478,
+     1745, 1479, 1482, 1484, 1485, 1746, 1493,  854,  493,  534,
+     1486, 1487, 1747, 1748, 1491, 1492, 1509, 1514, 1749, 1489,
+     1519, 1494, 1520, 1750, 1751, 1752,  743, 1521, 1522, 1753,
+     1525, 1527, 1524, 1754,  575,  616,  657,  698, 1531, 1533,
+     1530, 1534, 1535, 1536, 1755, 1537, 1538, 1539, 1544, 1541,
+     1546, 1547, 1540, 1548, 1549, 1550, 1554, 1756, 1562, 1757,
+     1565, 1552, 1568, 1572, 1758, 1759, 1573, 1579, 1574, 1580,
+     1582, 1588, 1760, 1589, 1761, 1590, 1593, 1594, 1595, 1600,
+     1762, 1763, 1597, 1601,  907, 1602, 1604, 1605, 1606, 1607,
+
+     1608, 1609, 1610, 1611, 1764, 1612, 1613, 1616, 1619, 1623,
+     1765, 1766, 1626, 1629, 1631, 1632, 1634, 1637, 1635, 1640,
+     1638, 1642, 1646, 1767, 1647, 1648, 1650, 1656, 1655, 1657,
+     1768, 1658, 1769, 1668, 1670, 1770, 1671, 1675, 1676, 1678,
+     1682, 1771, 1772, 1773, 1680, 1684, 1677, 1685, 1774, 1775,
+        1
     } ;
 
-static const flex_int16_t yy_def[473] =
+static const flex_int16_t yy_def[552] =
     {   0,
-      466,    1,  467,  467,  466,  466,  466,  468,  469,  470,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  468,  469,  466,
-      470,  466,  466,  470,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  471,  472,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-
-      466,  466,  466,  466,  471,  471,  472,  472,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,    0,  466,  466,  466,  466,
-      466,  466
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551
     } ;
 
-static const flex_int16_t yy_nxt[987] =
+static const flex_int16_t yy_nxt[1816] =
     {   0,
-        6,    7,    8,    9,   10,    6,   11,   12,   13,   13,
-       13,   13,    6,    6,   14,   15,   16,   17,   18,   19,
-        6,   20,   21,   22,    6,   23,   24,   25,   26,    6,
-       27,   28,   29,   30,   31,   32,    6,   33,    6,    6,
-       14,   15,   16,   17,   18,   19,    6,   20,   21,   22,
-        6,   23,   24,   25,   26,    6,   27,   28,   29,   30,
-       31,   32,    6,   33,    6,   35,   35,   42,   36,   36,
-       40,   40,   43,   46,   44,   45,   45,   45,   45,   48,
-       51,   56,   53,   59,   57,   94,   52,   58,   60,   49,
-       95,   47,   85,   42,   54,   40,   40,  407,   55,   46,
-
-      405,   86,   50,  313,  314,   48,   51,   56,   53,   59,
-       57,   94,   52,   58,   60,   49,   95,   47,   85,   61,
-       54,   62,   64,   63,   55,   65,   73,   86,   50,   66,
-       74,   67,   41,   38,   75,   77,  450,   98,  100,   76,
-      408,  180,   78,  181,   79,   61,   96,   62,   64,   63,
-       97,   65,   73,  101,  102,   66,   74,   67,   68,   69,
-       75,   77,   70,   98,  100,   76,   71,   87,   78,   88,
-       79,   72,   96,   90,  103,  104,   97,  105,   89,  101,
-      102,   91,  106,  109,   68,   69,  107,  108,   70,   92,
-      408,  406,   71,   87,  110,   88,   93,   72,   80,   90,
-
-      103,  104,   81,  105,   89,  111,   82,   91,  106,  109,
-      112,   83,  107,  108,   84,   92,   45,   45,   45,   45,
-      110,  113,   93,  114,   80,  115,  116,  117,   81,  118,
-      119,  111,   82,  120,  121,  122,  112,   83,  123,  125,
-       84,  126,  127,  124,  130,  128,  131,  113,  132,  114,
-      133,  115,  116,  117,  129,  118,  119,  134,  138,  120,
-      121,  122,  139,  406,  123,  125,  140,  126,  127,  124,
-      130,  128,  131,  141,  132,  135,  133,  142,  146,  143,
-      129,  144,  136,  134,  138,  147,  148,  151,  139,  137,
-      152,  153,  140,  145,  154,  155,  149,  156,  157,  141,
-
-      150,  135,  158,  142,  146,  143,  159,  144,  136,  162,
-      160,  147,  148,  151,  163,  137,  152,  153,  164,  145,
-      154,  155,  149,  156,  157,  166,  150,  161,  158,  167,
-      168,  169,  159,  170,  171,  162,  160,  172,  174,  175,
-      163,  176,  177,  178,  164,  179,  182,  183,  184,  185,
-      187,  166,  188,  161,  189,  167,  168,  169,  190,  170,
-      171,  173,  191,  172,  174,  175,  192,  176,  177,  178,
-      193,  179,  182,  183,  184,  185,  187,  194,  188,  195,
-      189,  196,  197,  198,  190,  199,  200,  201,  191,  202,
-      203,  205,  192,  206,  207,  208,  193,  204,  209,  210,
-
-      211,  212,  213,  194,  214,  195,  215,  196,  197,  198,
-      216,  199,  200,  201,  217,  202,  203,  205,  218,  206,
-      207,  208,  219,  204,  209,  210,  211,  212,  213,  220,
-      214,  221,  215,  222,  223,  224,  216,  225,  226,  227,
-      217,  228,  229,  230,  218,  231,  233,  234,  219,  235,
-      236,  237,  239,  240,  238,  220,  241,  221,  232,  222,
-      223,  224,  242,  225,  226,  227,  243,  228,  229,  230,
-      244,  231,  233,  234,  245,  235,  236,  237,  239,  240,
-      238,  246,  241,  247,  232,  248,  249,  250,  242,  251,
-      252,  253,  243,  254,  255,  256,  244,  257,  258,  259,
-
-      245,  260,  261,  263,  262,  264,  265,  246,  266,  247,
-      267,  248,  249,  250,  268,  251,  252,  253,  269,  254,
-      255,  256,  270,  257,  258,  259,  271,  260,  261,  263,
-      262,  264,  265,  272,  266,  273,  267,  274,  275,  276,
-      268,  277,  278,  279,  269,  280,  282,  283,  270,  284,
-      285,  286,  271,  287,  288,  289,  290,  291,  292,  272,
-      293,  273,  294,  274,  275,  276,  295,  277,  278,  279,
-      296,  280,  282,  283,  297,  284,  285,  286,  298,  287,
-      288,  289,  290,  291,  292,  299,  293,  300,  294,  301,
-      302,  303,  295,  304,  305,  306,  296,  307,  308,  309,
-
-      297,  310,  311,  312,  298,  315,  316,  317,  318,  319,
-      320,  299,  321,  300,  322,  301,  302,  303,  323,  304,
-      305,  306,  324,  307,  308,  309,  325,  310,  311,  312,
-      326,  315,  316,  317,  318,  319,  320,  328,  321,  329,
-      322,  330,  331,  327,  323,  332,  333,  334,  324,  335,
-      336,  337,  325,  338,  339,  340,  326,  341,  342,  343,
-      344,  345,  346,  328,  347,  329,  348,  330,  331,  327,
-      349,  332,  333,  334,  350,  335,  336,  337,  352,  338,
-      339,  340,  353,  341,  342,  343,  344,  345,  346,  354,
-      347,  355,  348,  357,  358,  360,  349,  361,  362,  363,
-
-      350,  364,  365,  366,  352,  367,  368,  369,  353,  370,
-      371,  372,  373,  374,  375,  354,  376,  355,  377,  357,
-      358,  360,  378,  361,  362,  363,  382,  364,  365,  366,
-      386,  367,  368,  369,  387,  370,  371,  372,  373,  374,
-      375,  379,  376,  383,  377,  384,  388,  380,  378,  392,
-      381,  389,  382,  393,  385,  394,  386,  395,  390,  396,
-      387,  391,  397,  398,  400,  401,  402,  379,  403,  404,
-      408,  409,  388,  380,  410,  392,  381,  389,  411,  393,
-      412,  394,  413,  395,  390,  396,  414,  391,  397,  398,
-      400,  401,  402,  415,  403,  404,  383,  409,  384,  416,
-
-      410,  417,  418,  419,  411,  420,  412,  385,  413,  421,
-      422,  423,  414,  424,  425,  426,  427,  428,  429,  415,
-      430,  431,  432,  433,  434,  416,  435,  417,  418,  419,
-      436,  420,  437,  438,  439,  421,  422,  423,  440,  424,
-      425,  426,  427,  428,  429,  441,  430,  431,  432,  433,
-      434,  442,  435,  443,  444,  445,  436,  446,  437,  438,
-      439,  447,  448,  449,  440,  451,  452,  453,  454,  455,
-      456,  441,  457,  458,  459,  460,  461,  442,  462,  443,
-      444,  445,  463,  446,  464,  465,  406,  447,  448,  449,
-      399,  451,  452,  453,  454,  455,  456,  359,  457,  458,
-
-      459,  460,  461,  356,  462,  351,  281,  186,  463,  165,
-      464,  465,   34,   34,   39,   39,   37,   99,   37,  466,
-        5,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,    5,    6,    7,    8,    9,   10,    6,   11,   12,
+       13,   13,   13,   13,    6,    6,   14,   15,   16,   17,
+       18,   19,    6,   20,   21,   22,    6,   23,   24,   25,
+       26,    6,   27,   28,   29,   30,   31,   32,    6,   33,
+       34,    6,    5,    6,    7,    8,    9,   10,    6,   11,
+       12,   13,   13,   13,   13,    6,    6,   14,   15,   16,
+
+       17,   18,   19,    6,   20,   21,   22,    6,   23,   24,
+       25,   26,    6,   27,   28,   29,   30,   31,   32,    6,
+       33,   34,    6,    5,   35,   35,   36,   35,   35,   37,
+       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+       35,   35,   35,   35,    5,   35,   35,   36,   35,   35,
+       37,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
+
+       35,   35,   35,   35,   35,    5,   40,   40,   41,   41,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,    5,   40,   40,   41,
+       41,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,    5,   39,   39,
+        5,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,    5,   42,
+       42,    5,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,    5,
+       39,   39,    5,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+        5,   42,   42,    5,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,    5,   42,   42,    5,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,    5,  445,  445,    5,  446,  445,  445,  445,
+
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,    5,  447,  447,    5,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  448,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,    5,  445,  445,    5,  446,  445,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,    5,  445,  445,    5,  446,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,  445,    5,  447,  447,    5,
+      447,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      448,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,    5,  447,  447,
+
+        5,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  448,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  447,    5,    5,
+        5,    5,    5,    5,    5,   38,   38,    5,   46,   46,
+       46,   46,    5,   71,   72,   83,   93,   73,  459,   84,
+        5,   74,  460,   85,   94,  461,   75,    5,   86,    5,
+        5,   87,   95,  462,  463,   52,    5,    5,   96,   97,
+      103,    5,   53,   67,   49,   76,   68,    5,   54,   77,
+       69,    5,   70,   78,   50,    5,   55,   80,   79,   43,
+
+       46,   46,   46,   46,   81,    5,   82,   51,   56,    5,
+       61,    5,   57,    5,   64,    5,   65,    5,   66,   44,
+        5,   45,   90,   62,   91,    5,  155,    5,   63,    5,
+      142,    5,  150,   92,  151,  248,  156,  143,  106,    5,
+      157,  418,    5,  419,  144,    5,  152,   47,  249,  250,
+      412,    5,  420,    5,  425,  418,  413,  419,    5,  414,
+       59,  426,    5,   60,  427,   48,  420,    5,  113,  114,
+       88,    5,    5,    5,    5,    5,    5,  100,    5,   89,
+        5,  101,    5,  192,    5,  193,    5,  169,    5,  135,
+      161,  183,    5,  245,  130,  102,  215,    5,  136,  131,
+
+        5,  162,    5,  216,  170,  246,    5,  336,  337,  255,
+       99,  279,  256,  280,    5,  184,  506,    5,  507,   58,
+      353,    5,  104,    5,   98,    5,    5,    5,    5,  105,
+        5,    5,  107,  354,    5,    5,    5,    5,  109,    5,
+        5,    5,  112,  111,    5,    5,    5,    5,  108,    5,
+      117,    5,    5,  118,    5,    5,    5,    5,  110,    5,
+      119,  125,  116,    5,    5,    5,  115,    5,  120,    5,
+      129,  121,  122,  133,  128,  123,  124,    5,  138,  141,
+      139,  134,  137,  126,  127,    5,    5,  147,  140,  132,
+        5,    5,    5,  149,    5,    5,  145,    5,  146,    5,
+
+        5,  154,    5,    5,    5,    5,    5,  158,  148,    5,
+        5,    5,    5,    5,    5,    5,  165,    5,  160,  153,
+        5,  167,  159,  172,  164,    5,  168,  163,  166,  176,
+      171,    5,  177,  178,    5,  173,    5,  179,    5,  188,
+      180,    5,  181,  174,    5,    5,  185,    5,    5,  175,
+        5,  186,  182,    5,    5,    5,    5,    5,    5,    5,
+        5,  191,    5,    5,    5,    5,  187,  189,    5,  200,
+      190,    5,  197,  195,  196,  202,  204,  194,    5,  205,
+        5,    5,    5,  206,    5,    5,  199,  207,  209,  201,
+      198,  203,  210,    5,  208,    5,    5,    5,  211,    5,
+
+      212,  213,    5,    5,  214,    5,    5,  218,    5,  217,
+        5,    5,  220,  222,    5,    5,    5,  219,  225,    5,
+        5,  221,  226,  224,  227,  228,    5,  230,    5,    5,
+        5,  223,    5,    5,    5,    5,  234,    5,  233,  236,
+        5,  231,  229,  232,  237,  238,    5,  235,    5,  242,
+      244,    5,    5,  240,    5,    5,    5,    5,    5,  247,
+      243,    5,  239,  251,  241,  253,    5,    5,    5,  252,
+      259,  258,    5,    5,  260,    5,  262,  263,    5,    5,
+      254,    5,  266,    5,  257,    5,    5,  261,  265,  268,
+        5,  264,    5,    5,    5,    5,    5,    5,    5,    5,
+
+      267,  269,  272,    5,    5,    5,  271,    5,    5,  273,
+        5,  270,  275,  276,  278,  283,  274,  285,    5,  281,
+      282,    5,    5,  291,  288,  284,    5,  286,  277,    5,
+        5,    5,    5,    5,  287,    5,    5,  289,    5,  290,
+        5,    5,  292,    5,    5,  293,    5,    5,    5,  296,
+      299,  297,  294,  295,  302,  301,  305,  300,  304,  306,
+      307,    5,    5,    5,  309,    5,  311,    5,    5,  298,
+        5,    5,  303,    5,    5,  310,  308,    5,    5,    5,
+      312,  314,    5,    5,    5,    5,  317,  319,    5,    5,
+      320,    5,  321,    5,    5,  315,    5,  328,    5,  313,
+
+      318,  322,  326,  316,  325,  323,  327,    5,  334,  324,
+      332,  329,  333,    5,    5,    5,    5,  331,    5,  330,
+        5,    5,    5,    5,    5,    5,    5,  335,    5,  341,
+        5,  338,  340,    5,    5,    5,  343,    5,  344,    5,
+        5,  339,    5,  350,    5,  346,  347,    5,  342,  349,
+      345,  352,    5,  355,    5,  348,    5,  362,    5,  351,
+      356,    5,  357,  358,    5,    5,    5,  360,    5,  359,
+        5,    5,    5,  361,  365,    5,    5,  363,    5,  364,
+        5,    5,    5,  370,    5,  366,    5,  369,  367,  368,
+      374,  375,  372,  371,  373,    5,  381,    5,    5,  378,
+
+        5,    5,    5,  376,    5,  383,    5,  377,  382,    5,
+        5,    5,    5,  380,  385,    5,    5,    5,  379,    5,
+      384,    5,    5,    5,  386,  387,    5,    5,  392,    5,
+      396,    5,  388,    5,  389,  395,    5,  393,  394,    5,
+      401,  402,  390,    5,  391,  403,  404,  406,    5,    5,
+      399,  400,  408,  398,    5,  397,  407,  405,  409,    5,
+      410,  411,    5,    5,    5,    5,    5,    5,  416,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,  417,
+      415,    5,  421,    5,    5,    5,    5,  422,    5,  424,
+        5,    5,    5,    5,    5,  430,  423,  428,  431,  432,
+
+      449,  433,  429,  434,  438,  435,  436,  440,    5,  441,
+      439,  444,  443,    5,  455,  437,  442,  451,    5,    5,
+        5,    5,  450,    5,    5,  452,    5,  457,  454,    5,
+        5,  453,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,  456,  458,    5,  465,    5,    5,    5,    5,    5,
+      468,    5,  472,    5,  464,  466,  469,  467,  478,  470,
+      473,    5,  471,  479,    5,  481,  482,    5,  474,  475,
+      476,    5,    5,    5,  480,  484,  486,  477,    5,    5,
+      483,    5,  485,  488,  487,  489,  490,    5,    5,    5,
+      491,  492,    5,    5,    5,  493,    5,  496,  494,    5,
+
+        5,    5,  497,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,  502,  495,    5,  499,  500,    5,  505,
+      504,  498,    5,  510,  501,    5,  511,  503,    5,  516,
+        5,    5,  509,    5,    5,  508,    5,    5,  519,    5,
+      522,    5,  513,  515,  512,    5,    5,    5,  514,    5,
+      520,  517,  518,  521,    5,    5,    5,    5,  525,  528,
+      523,  529,  526,  524,  533,  527,  531,    5,  532,    5,
+        5,  538,  530,  536,    5,    5,    5,    5,  534,    5,
+      535,    5,  537,    5,    5,    5,  540,    5,  541,    5,
+        5,    5,    5,    5,  544,    5,  539,  545,    5,  543,
+
+        5,  546,  547,  542,    5,    5,  548,    5,    5,    5,
+        5,    5,    5,  549,    5,    5,    5,    5,    5,    5,
+        5,  550,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[987] =
+static const flex_int16_t yy_chk[1816] =
     {   0,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  551,  551,  551,  551,  551,  551,
+      551,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    3,    4,   11,    3,    4,
-        9,    9,   12,   14,   12,   13,   13,   13,   13,   15,
-       16,   18,   17,   20,   19,   30,   16,   19,   20,   15,
-       31,   14,   27,   11,   17,   39,   39,  472,   17,   14,
-
-      471,   27,   15,  266,  266,   15,   16,   18,   17,   20,
-       19,   30,   16,   19,   20,   15,   31,   14,   27,   21,
-       17,   21,   22,   21,   17,   22,   24,   27,   15,   22,
-       24,   22,  470,  468,   24,   25,  443,   33,   42,   24,
-      408,  117,   25,  117,   25,   21,   32,   21,   22,   21,
-       32,   22,   24,   46,   47,   22,   24,   22,   23,   23,
-       24,   25,   23,   33,   42,   24,   23,   28,   25,   28,
-       25,   23,   32,   29,   48,   49,   32,   50,   28,   46,
-       47,   29,   51,   53,   23,   23,   52,   52,   23,   29,
-      407,  406,   23,   28,   54,   28,   29,   23,   26,   29,
-
-       48,   49,   26,   50,   28,   55,   26,   29,   51,   53,
-       56,   26,   52,   52,   26,   29,   45,   45,   45,   45,
-       54,   57,   29,   59,   26,   60,   61,   62,   26,   63,
-       64,   55,   26,   65,   66,   67,   56,   26,   68,   69,
-       26,   70,   71,   68,   73,   72,   74,   57,   75,   59,
-       76,   60,   61,   62,   72,   63,   64,   77,   80,   65,
-       66,   67,   81,  405,   68,   69,   82,   70,   71,   68,
-       73,   72,   74,   83,   75,   79,   76,   84,   86,   85,
-       72,   85,   79,   77,   80,   87,   88,   89,   81,   79,
-       90,   91,   82,   85,   92,   93,   88,   94,   95,   83,
-
-       88,   79,   96,   84,   86,   85,   97,   85,   79,  100,
-       98,   87,   88,   89,  101,   79,   90,   91,  102,   85,
-       92,   93,   88,   94,   95,  104,   88,   98,   96,  105,
-      106,  107,   97,  108,  109,  100,   98,  110,  111,  112,
-      101,  113,  114,  115,  102,  116,  119,  121,  122,  123,
-      125,  104,  126,   98,  127,  105,  106,  107,  128,  108,
-      109,  110,  129,  110,  111,  112,  130,  113,  114,  115,
-      131,  116,  119,  121,  122,  123,  125,  132,  126,  133,
-      127,  135,  137,  138,  128,  139,  140,  141,  129,  142,
-      143,  144,  130,  145,  146,  147,  131,  143,  148,  149,
-
-      150,  151,  152,  132,  153,  133,  154,  135,  137,  138,
-      155,  139,  140,  141,  156,  142,  143,  144,  157,  145,
-      146,  147,  158,  143,  148,  149,  150,  151,  152,  159,
-      153,  160,  154,  162,  163,  165,  155,  166,  167,  168,
-      156,  169,  170,  172,  157,  173,  174,  175,  158,  176,
-      177,  178,  179,  182,  178,  159,  183,  160,  173,  162,
-      163,  165,  184,  166,  167,  168,  186,  169,  170,  172,
-      187,  173,  174,  175,  188,  176,  177,  178,  179,  182,
-      178,  189,  183,  191,  173,  193,  194,  195,  184,  197,
-      198,  199,  186,  200,  202,  203,  187,  204,  205,  206,
-
-      188,  207,  208,  209,  208,  210,  211,  189,  212,  191,
-      213,  193,  194,  195,  214,  197,  198,  199,  217,  200,
-      202,  203,  218,  204,  205,  206,  219,  207,  208,  209,
-      208,  210,  211,  220,  212,  221,  213,  222,  223,  224,
-      214,  225,  227,  228,  217,  229,  231,  232,  218,  233,
-      234,  237,  219,  238,  239,  240,  241,  243,  244,  220,
-      245,  221,  246,  222,  223,  224,  247,  225,  227,  228,
-      248,  229,  231,  232,  249,  233,  234,  237,  250,  238,
-      239,  240,  241,  243,  244,  251,  245,  252,  246,  253,
-      254,  255,  247,  256,  257,  258,  248,  260,  261,  262,
-
-      249,  263,  264,  265,  250,  267,  268,  269,  272,  274,
-      275,  251,  276,  252,  277,  253,  254,  255,  278,  256,
-      257,  258,  279,  260,  261,  262,  280,  263,  264,  265,
-      281,  267,  268,  269,  272,  274,  275,  282,  276,  283,
-      277,  284,  286,  281,  278,  287,  290,  291,  279,  293,
-      294,  296,  280,  297,  299,  300,  281,  301,  302,  303,
-      304,  305,  306,  282,  308,  283,  309,  284,  286,  281,
-      310,  287,  290,  291,  311,  293,  294,  296,  316,  297,
-      299,  300,  317,  301,  302,  303,  304,  305,  306,  318,
-      308,  319,  309,  321,  322,  325,  310,  326,  327,  328,
-
-      311,  329,  330,  331,  316,  332,  333,  334,  317,  335,
-      337,  338,  340,  343,  344,  318,  345,  319,  346,  321,
-      322,  325,  350,  326,  327,  328,  353,  329,  330,  331,
-      356,  332,  333,  334,  357,  335,  337,  338,  340,  343,
-      344,  351,  345,  355,  346,  355,  358,  351,  350,  360,
-      351,  359,  353,  361,  355,  363,  356,  364,  359,  367,
-      357,  359,  368,  370,  375,  377,  379,  351,  380,  381,
-      385,  386,  358,  351,  387,  360,  351,  359,  389,  361,
-      390,  363,  391,  364,  359,  367,  393,  359,  368,  370,
-      375,  377,  379,  394,  380,  381,  383,  386,  383,  395,
-
-      387,  399,  400,  401,  389,  403,  390,  383,  391,  404,
-      409,  410,  393,  411,  412,  413,  415,  416,  417,  394,
-      418,  419,  420,  421,  422,  395,  424,  399,  400,  401,
-      425,  403,  426,  429,  431,  404,  409,  410,  433,  411,
-      412,  413,  415,  416,  417,  434,  418,  419,  420,  421,
-      422,  435,  424,  436,  437,  438,  425,  439,  426,  429,
-      431,  440,  441,  442,  433,  444,  445,  446,  449,  450,
-      451,  434,  452,  453,  454,  455,  457,  435,  458,  436,
-      437,  438,  460,  439,  462,  463,  384,  440,  441,  442,
-      371,  444,  445,  446,  449,  450,  451,  324,  452,  453,
-
-      454,  455,  457,  320,  458,  315,  230,  124,  460,  103,
-      462,  463,  467,  467,  469,  469,   37,   36,    7,    5,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466,  466,  466,  466,  466,
-      466,  466,  466,  466,  466,  466
+        1,    1,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+
+        4,    4,    4,    4,    4,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,    8,    8,    8,
+        6,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,   10,   10,
+       10,   35,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   39,
+       39,   39,   36,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       42,   42,   42,   41,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   45,   45,   45,   44,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,  419,  419,  419,   60,  419,  419,  419,  419,
+
+      419,  419,  419,  419,  419,  419,  419,  419,  419,  419,
+      419,  419,  419,  419,  419,  419,  419,  419,  419,  419,
+      419,  419,  419,  419,  419,  419,  419,  419,  419,  419,
+      419,  419,  419,  420,  420,  420,   81,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  445,  445,  445,  104,  445,  445,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+
+      445,  445,  445,  445,  445,  445,  445,  445,  445,  445,
+      445,  445,  445,  445,  445,  446,  446,  446,  125,  446,
+      446,  446,  446,  446,  446,  446,  446,  446,  446,  446,
+      446,  446,  446,  446,  446,  446,  446,  446,  446,  446,
+      446,  446,  446,  446,  446,  446,  446,  446,  446,  446,
+      446,  446,  446,  446,  446,  446,  447,  447,  447,  127,
+      447,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  447,  447,  447,
+      447,  447,  447,  447,  447,  447,  447,  448,  448,  448,
+
+      141,  448,  448,  448,  448,  448,  448,  448,  448,  448,
+      448,  448,  448,  448,  448,  448,  448,  448,  448,  448,
+      448,  448,  448,  448,  448,  448,  448,  448,  448,  448,
+      448,  448,  448,  448,  448,  448,  448,  448,   23,   13,
+       26,   29,  437,    7,   38,    7,   38,  143,   13,   13,
+       13,   13,   34,   23,   23,   26,   29,   23,  437,   26,
+       16,   23,  437,   26,   29,  437,   23,   22,   26,   15,
+       24,   26,   29,  437,  437,   16,   11,   25,   29,   29,
+       34,   17,   16,   22,   15,   24,   22,   21,   16,   24,
+       22,   46,   22,   24,   15,   20,   17,   25,   24,   11,
+
+       46,   46,   46,   46,   25,   28,   25,   15,   17,   91,
+       20,   82,   17,   12,   21,  184,   21,   88,   21,   12,
+       47,   12,   28,   20,   28,  170,   91,  379,   20,   14,
+       82,  390,   88,   28,   88,  184,   91,   82,   47,  385,
+       91,  385,   54,  385,   82,   19,   88,   14,  184,  184,
+      379,   27,  385,  418,  390,  418,  379,  418,   32,  379,
+       19,  390,   71,   19,  390,   14,  418,   95,   54,   54,
+       27,   75,  102,  124,  181,  116,   33,   32,  150,   27,
+      190,   32,   18,  124,  174,  124,  220,  102,   31,   75,
+       95,  116,   30,  181,   71,   33,  150,  284,   75,   71,
+
+      303,   95,   43,  150,  102,  181,  495,  284,  284,  190,
+       31,  220,  190,  220,   37,  116,  495,   48,  495,   18,
+      303,   49,   37,   50,   30,   51,   52,   53,   55,   43,
+       56,   57,   48,  303,   58,   59,   61,   62,   50,   63,
+       64,   65,   53,   52,   66,   67,   68,   70,   49,   69,
+       57,   72,   73,   58,   74,   79,   76,   77,   51,   80,
+       59,   66,   56,   78,   83,   87,   55,   84,   61,   85,
+       70,   62,   63,   73,   69,   64,   65,   86,   77,   80,
+       78,   74,   76,   67,   68,   89,   90,   85,   79,   72,
+       92,   93,   94,   87,   96,   97,   83,   98,   84,  101,
+
+       99,   90,  100,  103,  106,  107,  105,   92,   86,  108,
+      112,  111,  109,  110,  113,  114,   98,  120,   94,   89,
+      115,  100,   93,  105,   97,  118,  101,   96,   99,  109,
+      103,  117,  110,  111,  119,  106,  121,  112,  123,  120,
+      113,  122,  114,  107,  126,  128,  117,  129,  130,  108,
+      131,  118,  115,  132,  133,  134,  135,  137,  136,  139,
+      145,  123,  138,  142,  140,  144,  119,  121,  148,  133,
+      122,  149,  130,  128,  129,  135,  137,  126,  146,  138,
+      147,  151,  152,  139,  153,  154,  132,  140,  144,  134,
+      131,  136,  145,  155,  142,  156,  157,  159,  146,  158,
+
+      147,  148,  163,  160,  149,  161,  162,  152,  164,  151,
+      165,  166,  154,  156,  167,  168,  169,  153,  159,  172,
+      171,  155,  160,  158,  161,  162,  173,  164,  175,  176,
+      178,  157,  177,  179,  183,  180,  168,  185,  167,  171,
+      186,  165,  163,  166,  172,  173,  187,  169,  189,  178,
+      180,  191,  194,  176,  195,  196,  198,  199,  201,  183,
+      179,  200,  175,  185,  177,  187,  203,  205,  206,  186,
+      195,  194,  207,  209,  196,  210,  199,  200,  211,  212,
+      189,  214,  205,  215,  191,  216,  217,  198,  203,  207,
+      218,  201,  221,  224,  222,  219,  223,  231,  225,  226,
+
+      206,  209,  212,  229,  232,  236,  211,  233,  234,  214,
+      235,  210,  216,  217,  219,  223,  215,  225,  237,  221,
+      222,  238,  239,  234,  231,  224,  240,  226,  218,  242,
+      244,  243,  247,  249,  229,  246,  255,  232,  245,  233,
+      248,  250,  235,  252,  251,  236,  256,  257,  258,  239,
+      243,  240,  237,  238,  246,  245,  249,  244,  248,  250,
+      251,  259,  261,  262,  255,  263,  257,  264,  265,  242,
+      266,  267,  247,  268,  269,  256,  252,  270,  271,  272,
+      258,  261,  275,  274,  276,  273,  264,  266,  278,  279,
+      267,  280,  268,  282,  281,  262,  283,  275,  285,  259,
+
+      265,  269,  273,  263,  272,  270,  274,  286,  282,  271,
+      280,  276,  281,  287,  288,  291,  293,  279,  295,  278,
+      294,  296,  298,  297,  299,  300,  301,  283,  304,  288,
+      302,  285,  287,  306,  305,  307,  293,  309,  294,  310,
+      313,  286,  314,  300,  316,  296,  297,  317,  291,  299,
+      295,  302,  319,  304,  320,  298,  322,  314,  323,  301,
+      305,  324,  306,  307,  325,  326,  327,  310,  328,  309,
+      331,  329,  332,  313,  319,  333,  334,  316,  338,  317,
+      339,  340,  341,  325,  345,  320,  342,  324,  322,  323,
+      329,  331,  327,  326,  328,  344,  340,  343,  346,  334,
+
+      347,  348,  350,  332,  351,  342,  353,  333,  341,  352,
+      354,  356,  355,  339,  344,  357,  358,  359,  338,  360,
+      343,  361,  366,  362,  345,  346,  363,  365,  352,  368,
+      356,  371,  347,  372,  348,  355,  378,  353,  354,  373,
+      361,  362,  350,  374,  351,  363,  365,  368,  381,  382,
+      359,  360,  372,  358,  384,  357,  371,  366,  373,  387,
+      374,  378,  386,  388,  389,  392,  391,  393,  382,  397,
+      400,  396,  395,  401,  403,  404,  408,  410,  412,  384,
+      381,  413,  386,  414,  415,  421,  422,  387,  430,  389,
+      425,  426,  417,  432,  182,  393,  388,  391,  395,  396,
+
+      421,  397,  392,  400,  408,  401,  403,  412,  427,  413,
+      410,  417,  415,  428,  430,  404,  414,  425,  431,  433,
+      438,  439,  422,  443,  441,  426,  442,  432,  428,  451,
+      449,  427,  450,  452,  453,  454,  456,  457,  458,  463,
+      460,  431,  433,  459,  439,  461,  462,  464,  465,  466,
+      443,  472,  452,  467,  438,  441,  449,  442,  459,  450,
+      453,  469,  451,  460,  471,  462,  463,  473,  454,  456,
+      457,  474,  477,  479,  461,  465,  467,  458,  478,  480,
+      464,  481,  466,  471,  469,  472,  473,  482,  484,  486,
+      474,  477,  487,  488,  489,  478,  493,  481,  479,  490,
+
+      494,  496,  482,  497,  498,  499,  500,  501,  502,  503,
+      504,  506,  507,  489,  480,  508,  486,  487,  509,  494,
+      493,  484,  510,  498,  488,  513,  499,  490,  514,  504,
+      515,  516,  497,  517,  519,  496,  518,  521,  508,  520,
+      513,  522,  501,  503,  500,  523,  525,  526,  502,  527,
+      509,  506,  507,  510,  529,  528,  530,  532,  516,  519,
+      514,  520,  517,  515,  525,  518,  522,  534,  523,  535,
+      537,  530,  521,  528,  538,  539,  547,  540,  526,  545,
+      527,  541,  529,  546,  548,  188,  534,  192,  535,  193,
+      197,  202,  204,  208,  539,  213,  532,  540,  227,  538,
+
+      228,  541,  545,  537,  230,  241,  546,  253,  254,  260,
+      277,  289,  290,  547,  292,  308,  311,  312,  315,  318,
+      321,  548,  330,  335,  336,  337,  349,  364,  367,  369,
+      370,  375,  376,  377,  380,  383,  394,  398,  399,  402,
+      405,  406,  407,  409,  411,  416,  423,  424,  429,  434,
+      435,  436,  440,  444,  455,  468,  470,  475,  476,  483,
+      485,  491,  492,  505,  511,  512,  524,  531,  533,  536,
+      542,  543,  544,  549,  550,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -887,8 +1096,8 @@ conf_yy_fatal_error(const char *msg)
 {
   return 0;
 }
-#line 890 "config-lexer.c"
-#line 891 "config-lexer.c"
+#line 1099 "config-lexer.c"
+#line 1100 "config-lexer.c"
 
 #define INITIAL 0
 #define IN_COMMENT 1
@@ -1107,7 +1316,7 @@ YY_DECL
 #line 88 "config-lexer.l"
 
 
-#line 1110 "config-lexer.c"
+#line 1319 "config-lexer.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1140,13 +1349,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 467 )
+				if ( yy_current_state >= 552 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 466 );
+		while ( yy_current_state != 551 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1285,518 +1494,578 @@ YY_RULE_SETUP
 case 15:
 YY_RULE_SETUP
 #line 146 "config-lexer.l"
-{ return CHANNEL;      }
+{ return CACHE_TTL;    }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
 #line 147 "config-lexer.l"
-{ return COMMAND_INTERVAL; }
+{ return CHANNEL;      }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
 #line 148 "config-lexer.l"
-{ return COMMAND_QUEUE_SIZE; }
+{ return COMMAND_INTERVAL; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
 #line 149 "config-lexer.l"
-{ return COMMAND_TIMEOUT; }
+{ return COMMAND_QUEUE_SIZE; }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
 #line 150 "config-lexer.l"
-{ return CONNREGEX;    }
+{ return COMMAND_TIMEOUT; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
 #line 151 "config-lexer.l"
-{ return DNS_FDLIMIT;  }
+{ return CONNECT_RATE; }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 152 "config-lexer.l"
-{ return DNS_TIMEOUT;  }
+{ return CONNREGEX;    }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
 #line 153 "config-lexer.l"
-{ return DNSBL_FROM;   }
+{ return DNS_FDLIMIT;  }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
 #line 154 "config-lexer.l"
-{ return DNSBL_TO;     }
+{ return DNS_TIMEOUT;  }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
 #line 155 "config-lexer.l"
-{ return EXEMPT;       }
+{ return DNS_UDP_SIZE; }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
 #line 156 "config-lexer.l"
-{ return FD;           }
+{ return DNSBL_FROM;   }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 157 "config-lexer.l"
-{ return INVITE;       }
+{ return DNSBL_TO;     }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
 #line 158 "config-lexer.l"
-{ return IPV4;         }
+{ return EXEMPT;       }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
 #line 159 "config-lexer.l"
-{ return IPV6;         }
+{ return FD;           }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
 #line 160 "config-lexer.l"
-{ return IRC;          }
+{ return HASH;         }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
 #line 161 "config-lexer.l"
-{ return KLINE;        }
+{ return INVITE;       }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 162 "config-lexer.l"
-{ return KEY;          }
+{ return IPV4;         }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 163 "config-lexer.l"
-{ return MASK;         }
+{ return IPV6;         }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 164 "config-lexer.l"
-{ return MAX_READ;     }
+{ return IRC;          }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
 #line 165 "config-lexer.l"
-{ return MODE;         }
+{ return KLINE;        }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 166 "config-lexer.l"
-{ return NAME;         }
+{ return KEY;          }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 167 "config-lexer.l"
-{ return NEGCACHE;     }
+{ return MASK;         }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 168 "config-lexer.l"
-{ return NEGCACHE_REBUILD; }
+{ return MAX_READ;     }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 169 "config-lexer.l"
-{ return NICK;         }
+{ return MODE;         }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 170 "config-lexer.l"
-{ return NICKSERV;     }
+{ return NAME;         }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 171 "config-lexer.l"
-{ return NOTICE;       }
+{ return NEGCACHE;     }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 172 "config-lexer.l"
-{ return OPER;         }
+{ return NEGCACHE_BACKEND; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 173 "config-lexer.l"
-{ return OPM;          }
+{ return NEGCACHE_FILE; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 174 "config-lexer.l"
-{ return OPTIONS;      }
+{ return NEGCACHE_IPV4_PREFIX; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
 #line 175 "config-lexer.l"
-{ return PASSWORD;     }
+{ return NEGCACHE_IPV6_PREFIX; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 176 "config-lexer.l"
-{ return PERFORM;      }
+{ return NEGCACHE_REBUILD; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 177 "config-lexer.l"
-{ return PIDFILE;      }
+{ return NEGCACHE_SNAPSHOT; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 178 "config-lexer.l"
-{ return PORT;         }
+{ return NICK;         }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 179 "config-lexer.l"
-{ return PROTOCOL;     }
+{ return NICKSERV;     }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 180 "config-lexer.l"
-{ return READTIMEOUT;  }
+{ return NOTICE;       }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 181 "config-lexer.l"
-{ return REALNAME;     }
+{ return OPER;         }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 182 "config-lexer.l"
-{ return RECONNECTINTERVAL; }
+{ return OPM;          }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 183 "config-lexer.l"
-{ return REPLY;        }
+{ return OPTIONS;      }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 184 "config-lexer.l"
-{ return SCANLOG;      }
+{ return PASSWORD;     }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 185 "config-lexer.l"
-{ return SCANNER;      }
+{ return PERFORM;      }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 186 "config-lexer.l"
-{ return SENDMAIL;     }
+{ return PIDFILE;      }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 187 "config-lexer.l"
-{ return SERVER;       }
+{ return PORT;         }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 188 "config-lexer.l"
-{ return TARGET_IP;    }
+{ return PROTOCOL;     }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 189 "config-lexer.l"
-{ return TARGET_PORT;  }
+{ return READTIMEOUT;  }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 190 "config-lexer.l"
-{ return TARGET_STRING;}
+{ return REALNAME;     }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 191 "config-lexer.l"
-{ return TIMEOUT;      }
+{ return RECONNECTINTERVAL; }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 192 "config-lexer.l"
-{ return TYPE;         }
+{ return REPLY;        }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 193 "config-lexer.l"
-{ return USER;         }
+{ return SCANLOG;      }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 194 "config-lexer.l"
-{ return USERNAME;     }
+{ return SCANNER;      }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 195 "config-lexer.l"
-{ return VHOST;        }
+{ return SENDMAIL;     }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 197 "config-lexer.l"
-{ return YEARS; }
+#line 196 "config-lexer.l"
+{ return SERVER;       }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 198 "config-lexer.l"
-{ return YEARS; }
+#line 197 "config-lexer.l"
+{ return TARGET_IP;    }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 199 "config-lexer.l"
-{ return MONTHS; }
+#line 198 "config-lexer.l"
+{ return TARGET_PORT;  }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 200 "config-lexer.l"
-{ return MONTHS; }
+#line 199 "config-lexer.l"
+{ return TARGET_STRING;}
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 201 "config-lexer.l"
-{ return WEEKS; }
+#line 200 "config-lexer.l"
+{ return TIMEOUT;      }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 202 "config-lexer.l"
-{ return WEEKS; }
+#line 201 "config-lexer.l"
+{ return TRIE;         }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 203 "config-lexer.l"
-{ return DAYS; }
+#line 202 "config-lexer.l"
+{ return TXT_REASON;   }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 204 "config-lexer.l"
-{ return DAYS; }
+#line 203 "config-lexer.l"
+{ return TYPE;         }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 205 "config-lexer.l"
-{ return HOURS; }
+#line 204 "config-lexer.l"
+{ return USER;         }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 206 "config-lexer.l"
-{ return HOURS; }
+#line 205 "config-lexer.l"
+{ return USERNAME;     }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-#line 207 "config-lexer.l"
-{ return MINUTES; }
+#line 206 "config-lexer.l"
+{ return VHOST;        }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-#line 208 "config-lexer.l"
-{ return MINUTES; }
+#line 207 "config-lexer.l"
+{ return ZONE_FILE;    }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 209 "config-lexer.l"
-{ return SECONDS; }
+{ return YEARS; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 210 "config-lexer.l"
-{ return SECONDS; }
+{ return YEARS; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
-#line 212 "config-lexer.l"
-{ return BYTES; }
+#line 211 "config-lexer.l"
+{ return MONTHS; }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
-#line 213 "config-lexer.l"
-{ return BYTES; }
+#line 212 "config-lexer.l"
+{ return MONTHS; }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
-#line 214 "config-lexer.l"
-{ return KBYTES; }
+#line 213 "config-lexer.l"
+{ return WEEKS; }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
-#line 215 "config-lexer.l"
-{ return KBYTES; }
+#line 214 "config-lexer.l"
+{ return WEEKS; }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
-#line 216 "config-lexer.l"
-{ return KBYTES; }
+#line 215 "config-lexer.l"
+{ return DAYS; }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
-#line 217 "config-lexer.l"
-{ return KBYTES; }
+#line 216 "config-lexer.l"
+{ return DAYS; }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
-#line 218 "config-lexer.l"
-{ return KBYTES; }
+#line 217 "config-lexer.l"
+{ return HOURS; }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
-#line 219 "config-lexer.l"
-{ return MBYTES; }
+#line 218 "config-lexer.l"
+{ return HOURS; }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
-#line 220 "config-lexer.l"
-{ return MBYTES; }
+#line 219 "config-lexer.l"
+{ return MINUTES; }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
-#line 221 "config-lexer.l"
-{ return MBYTES; }
+#line 220 "config-lexer.l"
+{ return MINUTES; }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
-#line 222 "config-lexer.l"
-{ return MBYTES; }
+#line 221 "config-lexer.l"
+{ return SECONDS; }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
-#line 223 "config-lexer.l"
-{ return MBYTES; }
+#line 222 "config-lexer.l"
+{ return SECONDS; }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
+#line 224 "config-lexer.l"
+{ return BYTES; }
+	YY_BREAK
+case 92:
+YY_RULE_SETUP
 #line 225 "config-lexer.l"
+{ return BYTES; }
+	YY_BREAK
+case 93:
+YY_RULE_SETUP
+#line 226 "config-lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 94:
+YY_RULE_SETUP
+#line 227 "config-lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 95:
+YY_RULE_SETUP
+#line 228 "config-lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 96:
+YY_RULE_SETUP
+#line 229 "config-lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 97:
+YY_RULE_SETUP
+#line 230 "config-lexer.l"
+{ return KBYTES; }
+	YY_BREAK
+case 98:
+YY_RULE_SETUP
+#line 231 "config-lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 99:
+YY_RULE_SETUP
+#line 232 "config-lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 100:
+YY_RULE_SETUP
+#line 233 "config-lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 101:
+YY_RULE_SETUP
+#line 234 "config-lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 102:
+YY_RULE_SETUP
+#line 235 "config-lexer.l"
+{ return MBYTES; }
+	YY_BREAK
+case 103:
+YY_RULE_SETUP
+#line 237 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_HTTP;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 92:
+case 104:
 YY_RULE_SETUP
-#line 230 "config-lexer.l"
+#line 242 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_HTTPPOST;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 93:
+case 105:
 YY_RULE_SETUP
-#line 235 "config-lexer.l"
+#line 247 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_HTTPS;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 94:
+case 106:
 YY_RULE_SETUP
-#line 240 "config-lexer.l"
+#line 252 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_HTTPSPOST;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 95:
+case 107:
 YY_RULE_SETUP
-#line 245 "config-lexer.l"
+#line 257 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_SOCKS4;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 96:
+case 108:
 YY_RULE_SETUP
-#line 250 "config-lexer.l"
+#line 262 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_SOCKS5;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 97:
+case 109:
 YY_RULE_SETUP
-#line 255 "config-lexer.l"
+#line 267 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_WINGATE;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 98:
+case 110:
 YY_RULE_SETUP
-#line 260 "config-lexer.l"
+#line 272 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_ROUTER;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 99:
+case 111:
 YY_RULE_SETUP
-#line 265 "config-lexer.l"
+#line 277 "config-lexer.l"
 {
                           yylval.number = OPM_TYPE_DREAMBOX;
                           return PROTOCOLTYPE;
                         }
 	YY_BREAK
-case 100:
+case 112:
 YY_RULE_SETUP
-#line 271 "config-lexer.l"
+#line 283 "config-lexer.l"
 {
                            yylval.number=1;
                            return NUMBER;
                          }
 	YY_BREAK
-case 101:
+case 113:
 YY_RULE_SETUP
-#line 275 "config-lexer.l"
+#line 287 "config-lexer.l"
 {
                            yylval.number=1;
                            return NUMBER;
                          }
 	YY_BREAK
-case 102:
+case 114:
 YY_RULE_SETUP
-#line 279 "config-lexer.l"
+#line 291 "config-lexer.l"
 {
                            yylval.number=1;
                            return NUMBER;
                          }
 	YY_BREAK
-case 103:
+case 115:
 YY_RULE_SETUP
-#line 286 "config-lexer.l"
+#line 298 "config-lexer.l"
 {
                            yylval.number=0;
                            return NUMBER;
                          }
 	YY_BREAK
-case 104:
+case 116:
 YY_RULE_SETUP
-#line 291 "config-lexer.l"
+#line 303 "config-lexer.l"
 {
                            yylval.number=0;
                            return NUMBER;
                          }
 	YY_BREAK
-case 105:
+case 117:
 YY_RULE_SETUP
-#line 296 "config-lexer.l"
+#line 308 "config-lexer.l"
 {
                            yylval.number=0;
                            return NUMBER;
                          }
 	YY_BREAK
-case 106:
+case 118:
 YY_RULE_SETUP
-#line 301 "config-lexer.l"
+#line 313 "config-lexer.l"
 { return yytext[0]; }
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 302 "config-lexer.l"
+#line 314 "config-lexer.l"
 { if (conf_eof()) yyterminate(); }
 	YY_BREAK
-case 107:
+case 119:
 YY_RULE_SETUP
-#line 304 "config-lexer.l"
+#line 316 "config-lexer.l"
 ECHO;
 	YY_BREAK
-#line 1799 "config-lexer.c"
+#line 2068 "config-lexer.c"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2092,7 +2361,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 467 )
+			if ( yy_current_state >= 552 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2120,11 +2389,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 467 )
+		if ( yy_current_state >= 552 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 466);
+	yy_is_jam = (yy_current_state == 551);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -2763,7 +3032,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 304 "config-lexer.l"
+#line 316 "config-lexer.l"
 
 
 static void
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 21 "config-parser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 21 "config-parser.y"
 
 #include <string.h>
 
@@ -74,26 +79,31 @@ int yylex(void);
 static void *tmp;  /* Variable to temporarily hold nodes before insertion to list */
 
 
-#line 78 "config-parser.c" /* yacc.c:339  */
+#line 83 "config-parser.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "y.tab.h".  */
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
 #ifndef YY_YY_CONFIG_PARSER_H_INCLUDED
 # define YY_YY_CONFIG_PARSER_H_INCLUDED
 /* Debug traces.  */
@@ -104,81 +114,102 @@ static void *tmp;  /* Variable to temporarily hold nodes before insertion to lis
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    ADDRESS_FAMILY = 258,
-    AWAY = 259,
-    BAN_UNKNOWN = 260,
-    BLACKLIST = 261,
-    BYTES = 262,
-    KBYTES = 263,
-    MBYTES = 264,
-    CHANNEL = 265,
-    COMMAND_INTERVAL = 266,
-    COMMAND_QUEUE_SIZE = 267,
-    COMMAND_TIMEOUT = 268,
-    CONNREGEX = 269,
-    DNS_FDLIMIT = 270,
-    DNS_TIMEOUT = 271,
-    DNSBL_FROM = 272,
-    DNSBL_TO = 273,
-    EXEMPT = 274,
-    FD = 275,
-    INVITE = 276,
-    IPV4 = 277,
-    IPV6 = 278,
-    IRC = 279,
-    KLINE = 280,
-    KEY = 281,
-    MASK = 282,
-    MAX_READ = 283,
-    MODE = 284,
-    NAME = 285,
-    NEGCACHE = 286,
-    NEGCACHE_REBUILD = 287,
-    NICK = 288,
-    NICKSERV = 289,
-    NOTICE = 290,
-    OPER = 291,
-    OPM = 292,
-    OPTIONS = 293,
-    PASSWORD = 294,
-    PERFORM = 295,
-    PIDFILE = 296,
-    PORT = 297,
-    PROTOCOL = 298,
-    READTIMEOUT = 299,
-    REALNAME = 300,
-    RECONNECTINTERVAL = 301,
-    REPLY = 302,
-    SCANLOG = 303,
-    SCANNER = 304,
-    SECONDS = 305,
-    MINUTES = 306,
-    HOURS = 307,
-    DAYS = 308,
-    WEEKS = 309,
-    MONTHS = 310,
-    YEARS = 311,
-    SENDMAIL = 312,
-    SERVER = 313,
-    TARGET_IP = 314,
-    TARGET_PORT = 315,
-    TARGET_STRING = 316,
-    TIMEOUT = 317,
-    TYPE = 318,
-    USERNAME = 319,
-    USER = 320,
-    VHOST = 321,
-    NUMBER = 322,
-    STRING = 323,
-    PROTOCOLTYPE = 324
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ADDRESS_FAMILY = 258,          /* ADDRESS_FAMILY  */
+    AWAY = 259,                    /* AWAY  */
+    BAN_UNKNOWN = 260,             /* BAN_UNKNOWN  */
+    BLACKLIST = 261,               /* BLACKLIST  */
+    BYTES = 262,                   /* BYTES  */
+    KBYTES = 263,                  /* KBYTES  */
+    MBYTES = 264,                  /* MBYTES  */
+    CACHE_TTL = 265,               /* CACHE_TTL  */
+    CHANNEL = 266,                 /* CHANNEL  */
+    COMMAND_INTERVAL = 267,        /* COMMAND_INTERVAL  */
+    COMMAND_QUEUE_SIZE = 268,      /* COMMAND_QUEUE_SIZE  */
+    COMMAND_TIMEOUT = 269,         /* COMMAND_TIMEOUT  */
+    CONNECT_RATE = 270,            /* CONNECT_RATE  */
+    CONNREGEX = 271,               /* CONNREGEX  */
+    DNS_FDLIMIT = 272,             /* DNS_FDLIMIT  */
+    DNS_TIMEOUT = 273,             /* DNS_TIMEOUT  */
+    DNS_UDP_SIZE = 274,            /* DNS_UDP_SIZE  */
+    DNSBL_FROM = 275,              /* DNSBL_FROM  */
+    DNSBL_TO = 276,                /* DNSBL_TO  */
+    EXEMPT = 277,                  /* EXEMPT  */
+    FD = 278,                      /* FD  */
+    HASH = 279,                    /* HASH  */
+    INVITE = 280,                  /* INVITE  */
+    IPV4 = 281,                    /* IPV4  */
+    IPV6 = 282,                    /* IPV6  */
+    IRC = 283,                     /* IRC  */
+    KLINE = 284,                   /* KLINE  */
+    KEY = 285,                     /* KEY  */
+    MASK = 286,                    /* MASK  */
+    MAX_READ = 287,                /* MAX_READ  */
+    MODE = 288,                    /* MODE  */
+    NAME = 289,                    /* NAME  */
+    NEGCACHE = 290,                /* NEGCACHE  */
+    NEGCACHE_BACKEND = 291,        /* NEGCACHE_BACKEND  */
+    NEGCACHE_FILE = 292,           /* NEGCACHE_FILE  */
+    NEGCACHE_IPV4_PREFIX = 293,    /* NEGCACHE_IPV4_PREFIX  */
+    NEGCACHE_IPV6_PREFIX = 294,    /* NEGCACHE_IPV6_PREFIX  */
+    NEGCACHE_REBUILD = 295,        /* NEGCACHE_REBUILD  */
+    NEGCACHE_SNAPSHOT = 296,       /* NEGCACHE_SNAPSHOT  */
+    NICK = 297,                    /* NICK  */
+    NICKSERV = 298,                /* NICKSERV  */
+    NOTICE = 299,                  /* NOTICE  */
+    OPER = 300,                    /* OPER  */
+    OPM = 301,                     /* OPM  */
+    OPTIONS = 302,                 /* OPTIONS  */
+    PASSWORD = 303,                /* PASSWORD  */
+    PERFORM = 304,                 /* PERFORM  */
+    PIDFILE = 305,                 /* PIDFILE  */
+    PORT = 306,                    /* PORT  */
+    PROTOCOL = 307,                /* PROTOCOL  */
+    READTIMEOUT = 308,             /* READTIMEOUT  */
+    REALNAME = 309,                /* REALNAME  */
+    RECONNECTINTERVAL = 310,       /* RECONNECTINTERVAL  */
+    REPLY = 311,                   /* REPLY  */
+    SCANLOG = 312,                 /* SCANLOG  */
+    SCANNER = 313,                 /* SCANNER  */
+    SECONDS = 314,                 /* SECONDS  */
+    MINUTES = 315,                 /* MINUTES  */
+    HOURS = 316,                   /* HOURS  */
+    DAYS = 317,                    /* DAYS  */
+    WEEKS = 318,                   /* WEEKS  */
+    MONTHS = 319,                  /* MONTHS  */
+    YEARS = 320,                   /* YEARS  */
+    SENDMAIL = 321,                /* SENDMAIL  */
+    SERVER = 322,                  /* SERVER  */
+    TARGET_IP = 323,               /* TARGET_IP  */
+    TARGET_PORT = 324,             /* TARGET_PORT  */
+    TARGET_STRING = 325,           /* TARGET_STRING  */
+    TIMEOUT = 326,                 /* TIMEOUT  */
+    TRIE = 327,                    /* TRIE  */
+    TXT_REASON = 328,              /* TXT_REASON  */
+    TYPE = 329,                    /* TYPE  */
+    USERNAME = 330,                /* USERNAME  */
+    USER = 331,                    /* USER  */
+    VHOST = 332,                   /* VHOST  */
+    ZONE_FILE = 333,               /* ZONE_FILE  */
+    NUMBER = 334,                  /* NUMBER  */
+    STRING = 335,                  /* STRING  */
+    PROTOCOLTYPE = 336             /* PROTOCOLTYPE  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define ADDRESS_FAMILY 258
 #define AWAY 259
 #define BAN_UNKNOWN 260
@@ -186,80 +217,91 @@ extern int yydebug;
 #define BYTES 262
 #define KBYTES 263
 #define MBYTES 264
-#define CHANNEL 265
-#define COMMAND_INTERVAL 266
-#define COMMAND_QUEUE_SIZE 267
-#define COMMAND_TIMEOUT 268
-#define CONNREGEX 269
-#define DNS_FDLIMIT 270
-#define DNS_TIMEOUT 271
-#define DNSBL_FROM 272
-#define DNSBL_TO 273
-#define EXEMPT 274
-#define FD 275
-#define INVITE 276
-#define IPV4 277
-#define IPV6 278
-#define IRC 279
-#define KLINE 280
-#define KEY 281
-#define MASK 282
-#define MAX_READ 283
-#define MODE 284
-#define NAME 285
-#define NEGCACHE 286
-#define NEGCACHE_REBUILD 287
-#define NICK 288
-#define NICKSERV 289
-#define NOTICE 290
-#define OPER 291
-#define OPM 292
-#define OPTIONS 293
-#define PASSWORD 294
-#define PERFORM 295
-#define PIDFILE 296
-#define PORT 297
-#define PROTOCOL 298
-#define READTIMEOUT 299
-#define REALNAME 300
-#define RECONNECTINTERVAL 301
-#define REPLY 302
-#define SCANLOG 303
-#define SCANNER 304
-#define SECONDS 305
-#define MINUTES 306
-#define HOURS 307
-#define DAYS 308
-#define WEEKS 309
-#define MONTHS 310
-#define YEARS 311
-#define SENDMAIL 312
-#define SERVER 313
-#define TARGET_IP 314
-#define TARGET_PORT 315
-#define TARGET_STRING 316
-#define TIMEOUT 317
-#define TYPE 318
-#define USERNAME 319
-#define USER 320
-#define VHOST 321
-#define NUMBER 322
-#define STRING 323
-#define PROTOCOLTYPE 324
+#define CACHE_TTL 265
+#define CHANNEL 266
+#define COMMAND_INTERVAL 267
+#define COMMAND_QUEUE_SIZE 268
+#define COMMAND_TIMEOUT 269
+#define CONNECT_RATE 270
+#define CONNREGEX 271
+#define DNS_FDLIMIT 272
+#define DNS_TIMEOUT 273
+#define DNS_UDP_SIZE 274
+#define DNSBL_FROM 275
+#define DNSBL_TO 276
+#define EXEMPT 277
+#define FD 278
+#define HASH 279
+#define INVITE 280
+#define IPV4 281
+#define IPV6 282
+#define IRC 283
+#define KLINE 284
+#define KEY 285
+#define MASK 286
+#define MAX_READ 287
+#define MODE 288
+#define NAME 289
+#define NEGCACHE 290
+#define NEGCACHE_BACKEND 291
+#define NEGCACHE_FILE 292
+#define NEGCACHE_IPV4_PREFIX 293
+#define NEGCACHE_IPV6_PREFIX 294
+#define NEGCACHE_REBUILD 295
+#define NEGCACHE_SNAPSHOT 296
+#define NICK 297
+#define NICKSERV 298
+#define NOTICE 299
+#define OPER 300
+#define OPM 301
+#define OPTIONS 302
+#define PASSWORD 303
+#define PERFORM 304
+#define PIDFILE 305
+#define PORT 306
+#define PROTOCOL 307
+#define READTIMEOUT 308
+#define REALNAME 309
+#define RECONNECTINTERVAL 310
+#define REPLY 311
+#define SCANLOG 312
+#define SCANNER 313
+#define SECONDS 314
+#define MINUTES 315
+#define HOURS 316
+#define DAYS 317
+#define WEEKS 318
+#define MONTHS 319
+#define YEARS 320
+#define SENDMAIL 321
+#define SERVER 322
+#define TARGET_IP 323
+#define TARGET_PORT 324
+#define TARGET_STRING 325
+#define TIMEOUT 326
+#define TRIE 327
+#define TXT_REASON 328
+#define TYPE 329
+#define USERNAME 330
+#define USER 331
+#define VHOST 332
+#define ZONE_FILE 333
+#define NUMBER 334
+#define STRING 335
+#define PROTOCOLTYPE 336
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 91 "config-parser.y" /* yacc.c:355  */
+#line 103 "config-parser.y"
 
   int number;
   char *string;
 
-#line 261 "config-parser.c" /* yacc.c:355  */
-};
+#line 303 "config-parser.c"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -268,40 +310,294 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_CONFIG_PARSER_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ADDRESS_FAMILY = 3,             /* ADDRESS_FAMILY  */
+  YYSYMBOL_AWAY = 4,                       /* AWAY  */
+  YYSYMBOL_BAN_UNKNOWN = 5,                /* BAN_UNKNOWN  */
+  YYSYMBOL_BLACKLIST = 6,                  /* BLACKLIST  */
+  YYSYMBOL_BYTES = 7,                      /* BYTES  */
+  YYSYMBOL_KBYTES = 8,                     /* KBYTES  */
+  YYSYMBOL_MBYTES = 9,                     /* MBYTES  */
+  YYSYMBOL_CACHE_TTL = 10,                 /* CACHE_TTL  */
+  YYSYMBOL_CHANNEL = 11,                   /* CHANNEL  */
+  YYSYMBOL_COMMAND_INTERVAL = 12,          /* COMMAND_INTERVAL  */
+  YYSYMBOL_COMMAND_QUEUE_SIZE = 13,        /* COMMAND_QUEUE_SIZE  */
+  YYSYMBOL_COMMAND_TIMEOUT = 14,           /* COMMAND_TIMEOUT  */
+  YYSYMBOL_CONNECT_RATE = 15,              /* CONNECT_RATE  */
+  YYSYMBOL_CONNREGEX = 16,                 /* CONNREGEX  */
+  YYSYMBOL_DNS_FDLIMIT = 17,               /* DNS_FDLIMIT  */
+  YYSYMBOL_DNS_TIMEOUT = 18,               /* DNS_TIMEOUT  */
+  YYSYMBOL_DNS_UDP_SIZE = 19,              /* DNS_UDP_SIZE  */
+  YYSYMBOL_DNSBL_FROM = 20,                /* DNSBL_FROM  */
+  YYSYMBOL_DNSBL_TO = 21,                  /* DNSBL_TO  */
+  YYSYMBOL_EXEMPT = 22,                    /* EXEMPT  */
+  YYSYMBOL_FD = 23,                        /* FD  */
+  YYSYMBOL_HASH = 24,                      /* HASH  */
+  YYSYMBOL_INVITE = 25,                    /* INVITE  */
+  YYSYMBOL_IPV4 = 26,                      /* IPV4  */
+  YYSYMBOL_IPV6 = 27,                      /* IPV6  */
+  YYSYMBOL_IRC = 28,                       /* IRC  */
+  YYSYMBOL_KLINE = 29,                     /* KLINE  */
+  YYSYMBOL_KEY = 30,                       /* KEY  */
+  YYSYMBOL_MASK = 31,                      /* MASK  */
+  YYSYMBOL_MAX_READ = 32,                  /* MAX_READ  */
+  YYSYMBOL_MODE = 33,                      /* MODE  */
+  YYSYMBOL_NAME = 34,                      /* NAME  */
+  YYSYMBOL_NEGCACHE = 35,                  /* NEGCACHE  */
+  YYSYMBOL_NEGCACHE_BACKEND = 36,          /* NEGCACHE_BACKEND  */
+  YYSYMBOL_NEGCACHE_FILE = 37,             /* NEGCACHE_FILE  */
+  YYSYMBOL_NEGCACHE_IPV4_PREFIX = 38,      /* NEGCACHE_IPV4_PREFIX  */
+  YYSYMBOL_NEGCACHE_IPV6_PREFIX = 39,      /* NEGCACHE_IPV6_PREFIX  */
+  YYSYMBOL_NEGCACHE_REBUILD = 40,          /* NEGCACHE_REBUILD  */
+  YYSYMBOL_NEGCACHE_SNAPSHOT = 41,         /* NEGCACHE_SNAPSHOT  */
+  YYSYMBOL_NICK = 42,                      /* NICK  */
+  YYSYMBOL_NICKSERV = 43,                  /* NICKSERV  */
+  YYSYMBOL_NOTICE = 44,                    /* NOTICE  */
+  YYSYMBOL_OPER = 45,                      /* OPER  */
+  YYSYMBOL_OPM = 46,                       /* OPM  */
+  YYSYMBOL_OPTIONS = 47,                   /* OPTIONS  */
+  YYSYMBOL_PASSWORD = 48,                  /* PASSWORD  */
+  YYSYMBOL_PERFORM = 49,                   /* PERFORM  */
+  YYSYMBOL_PIDFILE = 50,                   /* PIDFILE  */
+  YYSYMBOL_PORT = 51,                      /* PORT  */
+  YYSYMBOL_PROTOCOL = 52,                  /* PROTOCOL  */
+  YYSYMBOL_READTIMEOUT = 53,               /* READTIMEOUT  */
+  YYSYMBOL_REALNAME = 54,                  /* REALNAME  */
+  YYSYMBOL_RECONNECTINTERVAL = 55,         /* RECONNECTINTERVAL  */
+  YYSYMBOL_REPLY = 56,                     /* REPLY  */
+  YYSYMBOL_SCANLOG = 57,                   /* SCANLOG  */
+  YYSYMBOL_SCANNER = 58,                   /* SCANNER  */
+  YYSYMBOL_SECONDS = 59,                   /* SECONDS  */
+  YYSYMBOL_MINUTES = 60,                   /* MINUTES  */
+  YYSYMBOL_HOURS = 61,                     /* HOURS  */
+  YYSYMBOL_DAYS = 62,                      /* DAYS  */
+  YYSYMBOL_WEEKS = 63,                     /* WEEKS  */
+  YYSYMBOL_MONTHS = 64,                    /* MONTHS  */
+  YYSYMBOL_YEARS = 65,                     /* YEARS  */
+  YYSYMBOL_SENDMAIL = 66,                  /* SENDMAIL  */
+  YYSYMBOL_SERVER = 67,                    /* SERVER  */
+  YYSYMBOL_TARGET_IP = 68,                 /* TARGET_IP  */
+  YYSYMBOL_TARGET_PORT = 69,               /* TARGET_PORT  */
+  YYSYMBOL_TARGET_STRING = 70,             /* TARGET_STRING  */
+  YYSYMBOL_TIMEOUT = 71,                   /* TIMEOUT  */
+  YYSYMBOL_TRIE = 72,                      /* TRIE  */
+  YYSYMBOL_TXT_REASON = 73,                /* TXT_REASON  */
+  YYSYMBOL_TYPE = 74,                      /* TYPE  */
+  YYSYMBOL_USERNAME = 75,                  /* USERNAME  */
+  YYSYMBOL_USER = 76,                      /* USER  */
+  YYSYMBOL_VHOST = 77,                     /* VHOST  */
+  YYSYMBOL_ZONE_FILE = 78,                 /* ZONE_FILE  */
+  YYSYMBOL_NUMBER = 79,                    /* NUMBER  */
+  YYSYMBOL_STRING = 80,                    /* STRING  */
+  YYSYMBOL_PROTOCOLTYPE = 81,              /* PROTOCOLTYPE  */
+  YYSYMBOL_82_ = 82,                       /* '{'  */
+  YYSYMBOL_83_ = 83,                       /* '}'  */
+  YYSYMBOL_84_ = 84,                       /* ';'  */
+  YYSYMBOL_85_ = 85,                       /* '='  */
+  YYSYMBOL_86_ = 86,                       /* ':'  */
+  YYSYMBOL_87_ = 87,                       /* ','  */
+  YYSYMBOL_YYACCEPT = 88,                  /* $accept  */
+  YYSYMBOL_config = 89,                    /* config  */
+  YYSYMBOL_config_items = 90,              /* config_items  */
+  YYSYMBOL_timespec_ = 91,                 /* timespec_  */
+  YYSYMBOL_timespec = 92,                  /* timespec  */
+  YYSYMBOL_sizespec_ = 93,                 /* sizespec_  */
+  YYSYMBOL_sizespec = 94,                  /* sizespec  */
+  YYSYMBOL_options_entry = 95,             /* options_entry  */
+  YYSYMBOL_options_items = 96,             /* options_items  */
+  YYSYMBOL_options_item = 97,              /* options_item  */
+  YYSYMBOL_options_negcache = 98,          /* options_negcache  */
+  YYSYMBOL_options_negcache_rebuild = 99,  /* options_negcache_rebuild  */
+  YYSYMBOL_options_negcache_file = 100,    /* options_negcache_file  */
+  YYSYMBOL_options_negcache_snapshot = 101, /* options_negcache_snapshot  */
+  YYSYMBOL_options_negcache_backend = 102, /* options_negcache_backend  */
+  YYSYMBOL_options_negcache_ipv4_prefix = 103, /* options_negcache_ipv4_prefix  */
+  YYSYMBOL_options_negcache_ipv6_prefix = 104, /* options_negcache_ipv6_prefix  */
+  YYSYMBOL_options_pidfile = 105,          /* options_pidfile  */
+  YYSYMBOL_options_dns_fdlimit = 106,      /* options_dns_fdlimit  */
+  YYSYMBOL_options_dns_timeout = 107,      /* options_dns_timeout  */
+  YYSYMBOL_options_dns_udp_size = 108,     /* options_dns_udp_size  */
+  YYSYMBOL_options_scanlog = 109,          /* options_scanlog  */
+  YYSYMBOL_options_command_queue_size = 110, /* options_command_queue_size  */
+  YYSYMBOL_options_command_interval = 111, /* options_command_interval  */
+  YYSYMBOL_options_command_timeout = 112,  /* options_command_timeout  */
+  YYSYMBOL_irc_entry = 113,                /* irc_entry  */
+  YYSYMBOL_irc_items = 114,                /* irc_items  */
+  YYSYMBOL_irc_item = 115,                 /* irc_item  */
+  YYSYMBOL_irc_away = 116,                 /* irc_away  */
+  YYSYMBOL_irc_kline = 117,                /* irc_kline  */
+  YYSYMBOL_irc_mode = 118,                 /* irc_mode  */
+  YYSYMBOL_irc_nick = 119,                 /* irc_nick  */
+  YYSYMBOL_irc_nickserv = 120,             /* irc_nickserv  */
+  YYSYMBOL_irc_oper = 121,                 /* irc_oper  */
+  YYSYMBOL_irc_password = 122,             /* irc_password  */
+  YYSYMBOL_irc_perform = 123,              /* irc_perform  */
+  YYSYMBOL_irc_notice = 124,               /* irc_notice  */
+  YYSYMBOL_irc_port = 125,                 /* irc_port  */
+  YYSYMBOL_irc_readtimeout = 126,          /* irc_readtimeout  */
+  YYSYMBOL_irc_reconnectinterval = 127,    /* irc_reconnectinterval  */
+  YYSYMBOL_irc_realname = 128,             /* irc_realname  */
+  YYSYMBOL_irc_server = 129,               /* irc_server  */
+  YYSYMBOL_irc_username = 130,             /* irc_username  */
+  YYSYMBOL_irc_vhost = 131,                /* irc_vhost  */
+  YYSYMBOL_irc_connregex = 132,            /* irc_connregex  */
+  YYSYMBOL_channel_entry = 133,            /* channel_entry  */
+  YYSYMBOL_134_1 = 134,                    /* $@1  */
+  YYSYMBOL_channel_items = 135,            /* channel_items  */
+  YYSYMBOL_channel_item = 136,             /* channel_item  */
+  YYSYMBOL_channel_name = 137,             /* channel_name  */
+  YYSYMBOL_channel_key = 138,              /* channel_key  */
+  YYSYMBOL_channel_invite = 139,           /* channel_invite  */
+  YYSYMBOL_user_entry = 140,               /* user_entry  */
+  YYSYMBOL_141_2 = 141,                    /* $@2  */
+  YYSYMBOL_user_items = 142,               /* user_items  */
+  YYSYMBOL_user_item = 143,                /* user_item  */
+  YYSYMBOL_user_mask = 144,                /* user_mask  */
+  YYSYMBOL_user_scanner = 145,             /* user_scanner  */
+  YYSYMBOL_scanner_entry = 146,            /* scanner_entry  */
+  YYSYMBOL_147_3 = 147,                    /* $@3  */
+  YYSYMBOL_scanner_items = 148,            /* scanner_items  */
+  YYSYMBOL_scanner_item = 149,             /* scanner_item  */
+  YYSYMBOL_scanner_name = 150,             /* scanner_name  */
+  YYSYMBOL_scanner_vhost = 151,            /* scanner_vhost  */
+  YYSYMBOL_scanner_target_ip = 152,        /* scanner_target_ip  */
+  YYSYMBOL_scanner_target_string = 153,    /* scanner_target_string  */
+  YYSYMBOL_scanner_fd = 154,               /* scanner_fd  */
+  YYSYMBOL_scanner_target_port = 155,      /* scanner_target_port  */
+  YYSYMBOL_scanner_timeout = 156,          /* scanner_timeout  */
+  YYSYMBOL_scanner_max_read = 157,         /* scanner_max_read  */
+  YYSYMBOL_scanner_connect_rate = 158,     /* scanner_connect_rate  */
+  YYSYMBOL_scanner_protocol = 159,         /* scanner_protocol  */
+  YYSYMBOL_opm_entry = 160,                /* opm_entry  */
+  YYSYMBOL_opm_items = 161,                /* opm_items  */
+  YYSYMBOL_opm_item = 162,                 /* opm_item  */
+  YYSYMBOL_opm_dnsbl_from = 163,           /* opm_dnsbl_from  */
+  YYSYMBOL_opm_dnsbl_to = 164,             /* opm_dnsbl_to  */
+  YYSYMBOL_opm_sendmail = 165,             /* opm_sendmail  */
+  YYSYMBOL_opm_blacklist_entry = 166,      /* opm_blacklist_entry  */
+  YYSYMBOL_167_4 = 167,                    /* $@4  */
+  YYSYMBOL_blacklist_items = 168,          /* blacklist_items  */
+  YYSYMBOL_blacklist_item = 169,           /* blacklist_item  */
+  YYSYMBOL_blacklist_name = 170,           /* blacklist_name  */
+  YYSYMBOL_blacklist_address_family = 171, /* blacklist_address_family  */
+  YYSYMBOL_172_5 = 172,                    /* $@5  */
+  YYSYMBOL_blacklist_address_family_items = 173, /* blacklist_address_family_items  */
+  YYSYMBOL_blacklist_address_family_item = 174, /* blacklist_address_family_item  */
+  YYSYMBOL_blacklist_kline = 175,          /* blacklist_kline  */
+  YYSYMBOL_blacklist_type = 176,           /* blacklist_type  */
+  YYSYMBOL_blacklist_ban_unknown = 177,    /* blacklist_ban_unknown  */
+  YYSYMBOL_blacklist_txt_reason = 178,     /* blacklist_txt_reason  */
+  YYSYMBOL_blacklist_cache_ttl = 179,      /* blacklist_cache_ttl  */
+  YYSYMBOL_blacklist_zone_file = 180,      /* blacklist_zone_file  */
+  YYSYMBOL_blacklist_reply = 181,          /* blacklist_reply  */
+  YYSYMBOL_blacklist_reply_items = 182,    /* blacklist_reply_items  */
+  YYSYMBOL_blacklist_reply_item = 183,     /* blacklist_reply_item  */
+  YYSYMBOL_exempt_entry = 184,             /* exempt_entry  */
+  YYSYMBOL_exempt_items = 185,             /* exempt_items  */
+  YYSYMBOL_exempt_item = 186,              /* exempt_item  */
+  YYSYMBOL_exempt_mask = 187               /* exempt_mask  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
 
-/* Copy the second part of user declarations.  */
 
-#line 278 "config-parser.c" /* yacc.c:358  */
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
 #else
 typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -309,15 +605,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -331,47 +640,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -384,8 +689,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -450,8 +769,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -460,17 +778,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -483,11 +801,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -499,12 +817,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -516,42 +834,45 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   346
+#define YYLAST   403
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  76
+#define YYNTOKENS  88
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  90
+#define YYNNTS  100
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  170
+#define YYNRULES  191
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  370
+#define YYNSTATES  422
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   324
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   336
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,    75,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    74,    72,
-       2,    73,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,    87,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    86,    84,
+       2,    85,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    70,     2,    71,     2,     2,     2,     2,
+       2,     2,     2,    82,     2,    83,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -571,56 +892,72 @@ static const yytype_uint8 yytranslate[] =
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   106,   106,   107,   110,   111,   112,   113,   114,   115,
-     117,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     128,   128,   129,   130,   131,   132,   137,   139,   140,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,   153,
-     158,   163,   169,   174,   179,   185,   190,   195,   202,   204,
-     205,   207,   208,   209,   210,   211,   212,   213,   214,   215,
-     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
-     227,   233,   239,   245,   251,   257,   263,   269,   277,   285,
-     290,   295,   300,   306,   312,   318,   324,   333,   333,   349,
-     350,   352,   353,   354,   356,   364,   372,   383,   383,   398,
-     399,   401,   402,   403,   405,   415,   428,   428,   471,   472,
-     474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
-     485,   493,   501,   509,   525,   532,   539,   546,   553,   571,
-     573,   574,   576,   577,   578,   579,   580,   582,   588,   594,
-     603,   603,   622,   623,   625,   626,   627,   628,   629,   630,
-     631,   633,   642,   641,   649,   649,   650,   655,   662,   670,
-     682,   689,   691,   692,   694,   710,   712,   713,   715,   716,
-     718
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   118,   118,   119,   122,   123,   124,   125,   126,   127,
+     129,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     140,   140,   141,   142,   143,   144,   149,   151,   152,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   171,   176,   181,   187,   192,
+     195,   200,   205,   210,   216,   221,   226,   231,   237,   242,
+     247,   254,   256,   257,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   279,   285,   291,   297,   303,   309,   315,
+     321,   329,   337,   342,   347,   352,   358,   364,   370,   376,
+     385,   385,   401,   402,   404,   405,   406,   408,   416,   424,
+     435,   435,   450,   451,   453,   454,   455,   457,   467,   480,
+     480,   525,   526,   528,   529,   530,   531,   532,   533,   534,
+     535,   536,   537,   538,   540,   548,   556,   564,   580,   587,
+     594,   601,   608,   615,   633,   635,   636,   638,   639,   640,
+     641,   642,   644,   650,   656,   665,   665,   685,   686,   688,
+     689,   690,   691,   692,   693,   694,   695,   696,   697,   699,
+     708,   707,   715,   715,   716,   721,   728,   736,   748,   755,
+     762,   769,   777,   779,   780,   782,   798,   800,   801,   803,
+     804,   806
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "ADDRESS_FAMILY", "AWAY", "BAN_UNKNOWN",
-  "BLACKLIST", "BYTES", "KBYTES", "MBYTES", "CHANNEL", "COMMAND_INTERVAL",
-  "COMMAND_QUEUE_SIZE", "COMMAND_TIMEOUT", "CONNREGEX", "DNS_FDLIMIT",
-  "DNS_TIMEOUT", "DNSBL_FROM", "DNSBL_TO", "EXEMPT", "FD", "INVITE",
-  "IPV4", "IPV6", "IRC", "KLINE", "KEY", "MASK", "MAX_READ", "MODE",
-  "NAME", "NEGCACHE", "NEGCACHE_REBUILD", "NICK", "NICKSERV", "NOTICE",
+  "\"end of file\"", "error", "\"invalid token\"", "ADDRESS_FAMILY",
+  "AWAY", "BAN_UNKNOWN", "BLACKLIST", "BYTES", "KBYTES", "MBYTES",
+  "CACHE_TTL", "CHANNEL", "COMMAND_INTERVAL", "COMMAND_QUEUE_SIZE",
+  "COMMAND_TIMEOUT", "CONNECT_RATE", "CONNREGEX", "DNS_FDLIMIT",
+  "DNS_TIMEOUT", "DNS_UDP_SIZE", "DNSBL_FROM", "DNSBL_TO", "EXEMPT", "FD",
+  "HASH", "INVITE", "IPV4", "IPV6", "IRC", "KLINE", "KEY", "MASK",
+  "MAX_READ", "MODE", "NAME", "NEGCACHE", "NEGCACHE_BACKEND",
+  "NEGCACHE_FILE", "NEGCACHE_IPV4_PREFIX", "NEGCACHE_IPV6_PREFIX",
+  "NEGCACHE_REBUILD", "NEGCACHE_SNAPSHOT", "NICK", "NICKSERV", "NOTICE",
   "OPER", "OPM", "OPTIONS", "PASSWORD", "PERFORM", "PIDFILE", "PORT",
   "PROTOCOL", "READTIMEOUT", "REALNAME", "RECONNECTINTERVAL", "REPLY",
   "SCANLOG", "SCANNER", "SECONDS", "MINUTES", "HOURS", "DAYS", "WEEKS",
   "MONTHS", "YEARS", "SENDMAIL", "SERVER", "TARGET_IP", "TARGET_PORT",
-  "TARGET_STRING", "TIMEOUT", "TYPE", "USERNAME", "USER", "VHOST",
-  "NUMBER", "STRING", "PROTOCOLTYPE", "'{'", "'}'", "';'", "'='", "':'",
-  "','", "$accept", "config", "config_items", "timespec_", "timespec",
-  "sizespec_", "sizespec", "options_entry", "options_items",
-  "options_item", "options_negcache", "options_negcache_rebuild",
+  "TARGET_STRING", "TIMEOUT", "TRIE", "TXT_REASON", "TYPE", "USERNAME",
+  "USER", "VHOST", "ZONE_FILE", "NUMBER", "STRING", "PROTOCOLTYPE", "'{'",
+  "'}'", "';'", "'='", "':'", "','", "$accept", "config", "config_items",
+  "timespec_", "timespec", "sizespec_", "sizespec", "options_entry",
+  "options_items", "options_item", "options_negcache",
+  "options_negcache_rebuild", "options_negcache_file",
+  "options_negcache_snapshot", "options_negcache_backend",
+  "options_negcache_ipv4_prefix", "options_negcache_ipv6_prefix",
   "options_pidfile", "options_dns_fdlimit", "options_dns_timeout",
-  "options_scanlog", "options_command_queue_size",
+  "options_dns_udp_size", "options_scanlog", "options_command_queue_size",
   "options_command_interval", "options_command_timeout", "irc_entry",
   "irc_items", "irc_item", "irc_away", "irc_kline", "irc_mode", "irc_nick",
   "irc_nickserv", "irc_oper", "irc_password", "irc_perform", "irc_notice",
@@ -632,362 +969,389 @@ static const char *const yytname[] =
   "scanner_items", "scanner_item", "scanner_name", "scanner_vhost",
   "scanner_target_ip", "scanner_target_string", "scanner_fd",
   "scanner_target_port", "scanner_timeout", "scanner_max_read",
-  "scanner_protocol", "opm_entry", "opm_items", "opm_item",
-  "opm_dnsbl_from", "opm_dnsbl_to", "opm_sendmail", "opm_blacklist_entry",
-  "$@4", "blacklist_items", "blacklist_item", "blacklist_name",
-  "blacklist_address_family", "$@5", "blacklist_address_family_items",
-  "blacklist_address_family_item", "blacklist_kline", "blacklist_type",
-  "blacklist_ban_unknown", "blacklist_reply", "blacklist_reply_items",
-  "blacklist_reply_item", "exempt_entry", "exempt_items", "exempt_item",
-  "exempt_mask", YY_NULLPTR
+  "scanner_connect_rate", "scanner_protocol", "opm_entry", "opm_items",
+  "opm_item", "opm_dnsbl_from", "opm_dnsbl_to", "opm_sendmail",
+  "opm_blacklist_entry", "$@4", "blacklist_items", "blacklist_item",
+  "blacklist_name", "blacklist_address_family", "$@5",
+  "blacklist_address_family_items", "blacklist_address_family_item",
+  "blacklist_kline", "blacklist_type", "blacklist_ban_unknown",
+  "blacklist_txt_reason", "blacklist_cache_ttl", "blacklist_zone_file",
+  "blacklist_reply", "blacklist_reply_items", "blacklist_reply_item",
+  "exempt_entry", "exempt_items", "exempt_item", "exempt_mask", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     123,   125,    59,    61,    58,    44
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -294
+#define YYPACT_NINF (-336)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-294)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -141
+#define YYTABLE_NINF (-156)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -294,   138,  -294,   -63,   -54,   -52,   -38,  -294,  -294,  -294,
-    -294,   -24,  -294,    14,  -294,  -294,    23,    95,    37,   181,
-       9,    13,  -294,    -3,     4,  -294,  -294,  -294,    12,    18,
-      19,    20,    24,    31,    33,    35,    42,    44,    48,    49,
-      53,    59,    60,    63,    70,     0,  -294,  -294,  -294,  -294,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,
-    -294,  -294,  -294,  -294,  -294,    77,  -294,    73,    78,    82,
-       5,  -294,  -294,  -294,  -294,  -294,   150,  -294,    85,    87,
-      90,    92,    93,    97,    98,    99,   100,    36,  -294,  -294,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,   115,   124,
-     109,    96,  -294,   110,   111,   112,   113,   120,   121,   127,
-     137,   140,   141,    83,   139,   142,   139,   143,   146,   149,
-     147,  -294,   151,   152,   155,   156,   153,  -294,   157,   139,
-     159,   139,   161,   139,   139,   139,   169,   170,   167,  -294,
-    -294,   145,   168,    29,  -294,  -294,  -294,  -294,   171,   172,
-     173,   174,   175,   176,   177,   178,   179,    52,  -294,  -294,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,   182,  -294,
-     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
-     193,   148,   194,   195,   196,   197,   198,   199,  -294,   -18,
-     200,   201,   202,  -294,   144,   203,   204,   205,   206,   207,
-     208,   209,   210,   211,  -294,   216,   217,   214,  -294,   220,
-     221,   222,   223,   225,   224,   226,   139,   227,   228,  -294,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,
-    -294,  -294,   139,   139,   139,   139,   139,   139,   139,  -294,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,   180,   229,   230,
-      39,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,
-     231,   232,   233,   219,   234,    56,  -294,  -294,  -294,  -294,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,
-    -294,  -294,   236,   237,  -294,   238,    81,   239,   240,   166,
-     241,   242,   243,   244,   245,  -294,  -294,  -294,  -294,  -294,
-    -294,  -294,  -294,   250,   251,   252,   249,  -294,   253,   255,
-     256,   257,   260,   261,   258,  -294,  -294,  -294,  -294,   221,
-     221,   221,  -294,  -294,  -294,  -294,   264,  -294,  -294,  -294,
-    -294,  -294,   262,   263,   265,  -294,    51,   266,   267,   268,
-     259,   -58,  -294,   269,  -294,  -294,  -294,  -294,   270,  -294,
-    -294,  -294,  -294,  -294,    26,  -294,  -294,  -294,  -294,   275,
-     272,  -294,  -294,  -294,  -294,    51,   273,  -294,  -294,  -294
+    -336,   152,  -336,   -73,   -70,   -57,   -35,  -336,  -336,  -336,
+    -336,   -24,  -336,    11,  -336,  -336,     6,   139,   107,   206,
+      -1,    16,  -336,    -3,    19,  -336,  -336,  -336,    21,    24,
+      29,    30,    31,    35,    36,    44,    46,    48,    49,    57,
+      59,    62,    64,    66,    68,     0,  -336,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,    80,  -336,    69,    73,    74,
+      79,  -336,  -336,  -336,  -336,  -336,    95,  -336,    75,    78,
+      82,    85,    86,    90,    91,    92,    94,   100,   104,   106,
+     111,   115,   116,    22,  -336,  -336,  -336,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,
+      45,   163,    89,    20,  -336,   122,   123,   124,   125,   128,
+     129,   131,   132,   133,   137,    51,    56,   141,    56,   142,
+     147,   148,    81,  -336,   153,   149,   150,   156,   154,  -336,
+     155,    56,   160,    56,   176,    56,   178,    56,    50,   179,
+     181,   182,    56,    56,   184,   185,   174,  -336,  -336,   177,
+     191,     7,  -336,  -336,  -336,  -336,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   201,    55,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,   183,  -336,
+     203,   204,   205,   207,   208,   209,   210,   211,   212,   213,
+     214,   189,   215,   216,   217,   218,   219,   220,  -336,   -20,
+     221,   222,   223,  -336,    83,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
+     239,  -336,   186,   244,   241,  -336,   247,   248,   249,   250,
+      67,   251,   253,   254,    56,   255,   245,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,
+      56,    56,    56,    56,    56,    56,    56,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,   252,   256,   257,   -12,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,   258,   259,
+     260,   261,   265,   263,   264,   266,    63,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,
+    -336,  -336,  -336,   268,   269,  -336,   270,   271,    87,   272,
+     273,   274,   275,   277,   278,   279,   280,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,   285,   286,   287,   284,  -336,
+     288,   290,    56,   291,   292,   295,   296,   297,   298,   299,
+    -336,  -336,  -336,  -336,  -336,   249,   249,   249,  -336,  -336,
+    -336,  -336,   300,  -336,  -336,  -336,  -336,  -336,   301,   302,
+     303,  -336,    84,   304,   305,   306,   307,   308,   -55,  -336,
+     310,   311,   312,  -336,  -336,  -336,  -336,   313,  -336,  -336,
+    -336,  -336,  -336,   -81,  -336,  -336,  -336,  -336,  -336,   318,
+     315,  -336,  -336,  -336,  -336,  -336,  -336,    84,   316,  -336,
+    -336,  -336
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       2,    97,     1,     0,     0,     0,     0,     3,     5,     4,
+       2,   110,     1,     0,     0,     0,     0,     3,     5,     4,
        7,     0,     8,     0,     6,     9,     0,     0,     0,     0,
-       0,     0,   169,     0,     0,   167,   168,    69,     0,     0,
+       0,     0,   190,     0,     0,   188,   189,    82,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    63,    64,    66,    69,
+      67,    68,    70,    71,    79,    80,    72,    73,    74,    75,
+      76,    77,    78,    65,    81,     0,   151,     0,     0,     0,
+       0,   146,   147,   148,   149,   150,     0,    44,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    50,    51,    53,    56,
-      54,    55,    57,    58,    66,    67,    59,    60,    61,    62,
-      63,    64,    65,    52,    68,     0,   136,     0,     0,     0,
-       0,   131,   132,   133,   134,   135,     0,    38,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,     0,     0,
-       0,     0,   166,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       0,     0,     0,     0,   187,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    49,     0,     0,     0,     0,     0,   130,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    27,
-     103,     0,     0,     0,   100,   101,   102,   119,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   109,   110,
-     111,   113,   115,   112,   114,   117,   118,   116,     0,   165,
+       0,     0,     0,    62,     0,     0,     0,     0,     0,   145,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    10,     0,     0,     0,     0,     0,     0,    48,     0,
-       0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    26,     0,     0,     0,    99,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   108,
-     170,    70,    86,    71,    72,    73,    74,    78,    75,    76,
-      77,    79,    10,    10,    10,    10,    10,    10,    10,    12,
-      11,    80,    82,    81,    83,    84,    85,     0,     0,     0,
-       0,    90,    91,    92,    93,   137,   138,   139,   150,   152,
-       0,     0,     0,     0,     0,     0,   143,   144,   145,   147,
-     146,   148,   149,    46,    45,    47,    42,    43,    39,    40,
-      41,    44,     0,     0,    98,     0,    20,     0,     0,     0,
-       0,     0,     0,     0,     0,   107,    13,    14,    15,    16,
-      17,    18,    19,     0,     0,     0,     0,    89,     0,     0,
-       0,     0,     0,     0,     0,   142,   104,   105,   124,    20,
-      20,    20,    22,    21,   127,   120,     0,   122,   125,   123,
-     126,   121,     0,     0,     0,    88,     0,     0,     0,     0,
-       0,     0,   163,     0,   141,    23,    24,    25,     0,    96,
-      95,    94,   156,   157,     0,   155,   160,   158,   151,     0,
-       0,   162,   159,   128,   153,     0,     0,   161,   154,   164
+       0,     0,     0,     0,     0,     0,     0,    27,   116,     0,
+       0,     0,   113,   114,   115,   133,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     126,   128,   125,   127,   130,   131,   132,   129,     0,   186,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    10,     0,     0,     0,     0,     0,     0,    61,     0,
+       0,     0,     0,   144,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    26,     0,     0,     0,   112,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   121,   191,    83,
+      99,    84,    85,    86,    87,    91,    88,    89,    90,    92,
+      10,    10,    10,    10,    10,    10,    10,    12,    11,    93,
+      95,    94,    96,    97,    98,     0,     0,     0,     0,   103,
+     104,   105,   106,   152,   153,   154,   168,   170,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   158,   159,   160,
+     162,   161,   163,   164,   165,   166,   167,    59,    58,    60,
+      54,    55,    56,    45,    50,    49,    47,    51,    52,    46,
+      48,    53,    57,     0,     0,   111,     0,     0,    20,     0,
+       0,     0,     0,     0,     0,     0,     0,   120,    13,    14,
+      15,    16,    17,    18,    19,     0,     0,     0,     0,   102,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     157,   117,   118,   142,   138,    20,    20,    20,    22,    21,
+     141,   134,     0,   136,   139,   137,   140,   135,     0,     0,
+       0,   101,     0,     0,     0,     0,     0,     0,     0,   184,
+       0,     0,     0,   156,    23,    24,    25,     0,   109,   108,
+     107,   174,   175,     0,   173,   178,   180,   176,   169,     0,
+       0,   183,   179,   177,   181,   143,   171,     0,     0,   182,
+     172,   185
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -294,  -294,  -294,    -2,  -114,  -293,     6,  -294,  -294,   212,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,
-    -294,   278,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,  -294,
-    -294,  -294,    -8,  -294,  -294,  -294,  -294,  -294,  -294,   154,
-    -294,  -294,  -294,  -294,  -294,    86,  -294,  -294,  -294,  -294,
-    -294,  -294,  -294,  -294,  -294,  -294,  -294,   276,  -294,  -294,
-    -294,  -294,  -294,  -294,    68,  -294,  -294,  -294,  -294,   -69,
-    -294,  -294,  -294,  -294,  -294,   -43,  -294,  -294,   277,  -294
+    -336,  -336,  -336,     9,  -126,  -335,    52,  -336,  -336,   240,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,   293,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,    58,  -336,
+    -336,  -336,  -336,  -336,  -336,   242,  -336,  -336,  -336,  -336,
+    -336,   164,  -336,  -336,  -336,  -336,  -336,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,   314,  -336,  -336,  -336,  -336,  -336,
+    -336,    43,  -336,  -336,  -336,  -336,   -67,  -336,  -336,  -336,
+    -336,  -336,  -336,  -336,  -336,   -30,  -336,  -336,   346,  -336
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,     7,   239,   240,   322,   323,     8,    87,    88,
-      89,    90,    91,    92,    93,    94,    95,    96,    97,     9,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,   250,   251,   252,   253,   254,    10,    11,   143,   144,
-     145,   146,    12,    13,   157,   158,   159,   160,   161,   162,
-     163,   164,   165,   166,   167,    14,    70,    71,    72,    73,
-      74,    75,    76,   265,   266,   267,   268,   308,   354,   355,
-     269,   270,   271,   272,   341,   342,    15,    24,    25,    26
+       0,     1,     7,   267,   268,   368,   369,     8,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,     9,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,   278,   279,   280,
+     281,   282,    10,    11,   161,   162,   163,   164,    12,    13,
+     176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
+     186,   187,    14,    70,    71,    72,    73,    74,    75,    76,
+     296,   297,   298,   299,   350,   403,   404,   300,   301,   302,
+     303,   304,   305,   306,   388,   389,    15,    24,    25,    26
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     182,    27,   184,   247,    28,    22,    66,    16,   248,   340,
-     -87,  -140,   249,   360,    29,   195,    17,   197,    18,   199,
-     200,   201,    67,    68,    22,    30,   345,   346,   347,    31,
-     140,    23,    19,    32,    33,    34,    35,    77,    66,    36,
-      37,    20,    38,  -140,    39,    40,    41,    78,    79,    80,
-      23,    81,    82,   147,    67,    68,   141,   258,    42,   259,
-     247,   260,    69,    21,    43,   248,    44,    83,    84,   249,
-     100,   120,   148,   352,   353,   101,   126,    85,   142,    98,
-     149,   261,   150,    99,    86,   103,   262,   122,   319,   320,
-     321,   104,   105,   106,    69,   151,    27,   107,   364,    28,
-     207,   365,   293,   263,   108,   -87,   109,   138,   110,    29,
-     306,   152,   153,   154,   155,   111,   140,   112,   156,   264,
-      30,   113,   114,   218,    31,   147,   115,   314,    32,    33,
-      34,    35,   116,   117,    36,    37,   118,    38,     2,    39,
-      40,    41,   141,   119,   148,   258,   123,   259,   286,   260,
-     180,   124,   149,    42,   150,   125,   128,     3,   129,    43,
-     130,    44,     4,   131,   142,   132,   133,   151,   169,   261,
-     134,   135,   136,   137,   262,     5,     6,   168,   170,   171,
-     172,   173,    77,   152,   153,   154,   155,  -106,   174,   175,
-     156,   263,    78,    79,    80,   176,    81,    82,   232,   233,
-     234,   235,   236,   237,   238,   177,   181,   264,   178,   179,
-     183,   185,    83,    84,   186,   181,   287,   187,   205,   188,
-     190,   189,    85,   191,   192,   193,   196,   194,   198,    86,
-     296,   297,   298,   299,   300,   301,   302,   202,   203,   204,
-     326,   206,   307,   219,   209,   210,   211,   212,   213,   214,
-     215,   216,   217,   303,   220,   221,   222,   223,   224,   225,
-     226,   227,   228,   229,   230,   231,   241,   242,   243,   244,
-     245,   246,   255,   256,   257,   273,   274,   275,   276,   277,
-     278,   279,   280,   281,   282,   283,   284,   285,   286,   312,
-     288,   291,   289,   290,   292,   294,   368,   208,   361,   139,
-     295,   102,   304,   305,   309,   310,   311,   313,   316,   317,
-     318,   324,   325,   327,   328,   329,   330,   331,   332,   333,
-     334,   335,   337,   121,   338,   339,   336,   340,     0,   343,
-     344,   348,   359,   315,   349,   350,     0,   351,   356,   357,
-     358,   362,   363,   366,   367,   369,   127
+     202,    27,   204,   416,    28,   275,   417,    22,   158,    16,
+     276,  -100,    17,   275,   277,   215,    29,   217,   276,   219,
+      22,   221,   277,    77,   387,    18,   227,   228,   410,    30,
+     394,   395,   396,    31,    78,    79,    80,    23,   159,    81,
+      82,    83,    32,    33,    34,    35,   158,    19,    36,    37,
+      23,    38,    20,    39,    40,    41,   165,    84,    85,    86,
+      87,    88,    89,    90,   286,   160,   287,    42,   288,    21,
+     166,   348,    91,   289,   222,    43,   159,    44,   167,    92,
+      66,   110,   112,   132,   286,  -155,   287,   168,   288,   169,
+     234,   134,   290,   289,   365,   366,   367,   291,   111,    67,
+      68,   140,   113,   160,   189,   156,   115,   170,    66,   116,
+     401,   402,   290,  -155,   117,   118,   119,   291,   335,   292,
+     120,   121,   223,   171,   172,   173,   174,    67,    68,   122,
+     200,   123,   175,   124,   125,   201,   293,   294,   246,   292,
+      27,   295,   126,    28,   127,    69,   359,   128,   331,   129,
+    -100,   130,     2,   131,   135,    29,   293,   294,   136,   137,
+     141,   295,   138,   142,   165,   208,   328,   143,    30,   188,
+     144,   145,    31,    69,     3,   146,   147,   148,   166,   149,
+       4,    32,    33,    34,    35,   150,   167,    36,    37,   151,
+      38,   152,    39,    40,    41,   168,   153,   169,     5,     6,
+     154,   155,   190,   191,   192,   193,    42,    77,   194,   195,
+    -119,   196,   197,   198,    43,   170,    44,   199,    78,    79,
+      80,   203,   205,    81,    82,    83,   384,   206,   207,   210,
+     211,   171,   172,   173,   174,   209,   212,   214,   213,   216,
+     175,    84,    85,    86,    87,    88,    89,    90,   260,   261,
+     262,   263,   264,   265,   266,   218,    91,   220,   231,   224,
+     225,   226,   232,    92,   229,   230,   323,   248,   201,   338,
+     339,   340,   341,   342,   343,   344,   233,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,   245,   249,   250,   251,
+     329,   252,   253,   254,   255,   256,   257,   258,   259,   269,
+     270,   271,   272,   273,   274,   283,   284,   285,   307,   308,
+     309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
+     319,   320,   321,   322,   324,   325,   326,   327,   328,   337,
+     330,   332,   333,   157,   334,   336,   349,   345,   133,   360,
+     247,   346,   347,   351,   352,   353,   354,   355,   356,   357,
+     420,   358,   361,   362,   363,   364,   370,   371,   411,   373,
+     372,   374,   375,   376,   377,   378,   379,   380,   381,   383,
+     114,   385,   386,   382,   387,   390,     0,   391,   392,   397,
+       0,     0,     0,   393,   139,   398,   399,   400,   405,   406,
+     407,   408,     0,   409,   412,   413,   414,   415,   418,   419,
+     421,     0,     0,   235
 };
 
 static const yytype_int16 yycheck[] =
 {
-     114,     1,   116,    21,     4,     1,     1,    70,    26,    67,
-      10,     6,    30,    71,    14,   129,    70,   131,    70,   133,
-     134,   135,    17,    18,     1,    25,   319,   320,   321,    29,
-       1,    27,    70,    33,    34,    35,    36,     1,     1,    39,
-      40,    65,    42,     6,    44,    45,    46,    11,    12,    13,
-      27,    15,    16,     1,    17,    18,    27,     1,    58,     3,
-      21,     5,    57,    49,    64,    26,    66,    31,    32,    30,
-      73,    71,    20,    22,    23,    71,    71,    41,    49,    70,
-      28,    25,    30,    70,    48,    73,    30,    10,     7,     8,
-       9,    73,    73,    73,    57,    43,     1,    73,    72,     4,
-      71,    75,   216,    47,    73,    10,    73,    71,    73,    14,
-      71,    59,    60,    61,    62,    73,     1,    73,    66,    63,
-      25,    73,    73,    71,    29,     1,    73,    71,    33,    34,
-      35,    36,    73,    73,    39,    40,    73,    42,     0,    44,
-      45,    46,    27,    73,    20,     1,    73,     3,    67,     5,
-      67,    73,    28,    58,    30,    73,     6,    19,    73,    64,
-      73,    66,    24,    73,    49,    73,    73,    43,    72,    25,
-      73,    73,    73,    73,    30,    37,    38,    68,    68,    68,
-      68,    68,     1,    59,    60,    61,    62,    49,    68,    68,
-      66,    47,    11,    12,    13,    68,    15,    16,    50,    51,
-      52,    53,    54,    55,    56,    68,    67,    63,    68,    68,
-      68,    68,    31,    32,    68,    67,   210,    68,    73,    72,
-      68,    70,    41,    68,    68,    72,    67,    70,    67,    48,
-     232,   233,   234,   235,   236,   237,   238,    68,    68,    72,
-      74,    73,   250,   157,    73,    73,    73,    73,    73,    73,
-      73,    73,    73,    73,    72,    72,    72,    72,    72,    72,
-      72,    72,    72,    72,    72,    72,    72,    72,    72,    72,
-      72,    72,    72,    72,    72,    72,    72,    72,    72,    72,
-      72,    72,    72,    72,    68,    68,    72,    67,    67,    70,
-      68,    67,    69,    68,    68,    68,   365,   143,   341,    87,
-      72,    24,    73,    73,    73,    73,    73,    73,    72,    72,
-      72,    72,    72,    72,    72,    72,    72,    72,    68,    68,
-      68,    72,    67,    45,    68,    68,    73,    67,    -1,    68,
-      72,    67,    73,   265,    72,    72,    -1,    72,    72,    72,
-      72,    72,    72,    68,    72,    72,    70
+     126,     1,   128,    84,     4,    25,    87,     1,     1,    82,
+      30,    11,    82,    25,    34,   141,    16,   143,    30,   145,
+       1,   147,    34,     1,    79,    82,   152,   153,    83,    29,
+     365,   366,   367,    33,    12,    13,    14,    31,    31,    17,
+      18,    19,    42,    43,    44,    45,     1,    82,    48,    49,
+      31,    51,    76,    53,    54,    55,     1,    35,    36,    37,
+      38,    39,    40,    41,     1,    58,     3,    67,     5,    58,
+      15,    83,    50,    10,    24,    75,    31,    77,    23,    57,
+       1,    82,    85,    83,     1,     6,     3,    32,     5,    34,
+      83,    11,    29,    10,     7,     8,     9,    34,    82,    20,
+      21,     6,    83,    58,    84,    83,    85,    52,     1,    85,
+      26,    27,    29,     6,    85,    85,    85,    34,   244,    56,
+      85,    85,    72,    68,    69,    70,    71,    20,    21,    85,
+      79,    85,    77,    85,    85,    79,    73,    74,    83,    56,
+       1,    78,    85,     4,    85,    66,    83,    85,    81,    85,
+      11,    85,     0,    85,    85,    16,    73,    74,    85,    85,
+      85,    78,    83,    85,     1,    84,    79,    85,    29,    80,
+      85,    85,    33,    66,    22,    85,    85,    85,    15,    85,
+      28,    42,    43,    44,    45,    85,    23,    48,    49,    85,
+      51,    85,    53,    54,    55,    32,    85,    34,    46,    47,
+      85,    85,    80,    80,    80,    80,    67,     1,    80,    80,
+      58,    80,    80,    80,    75,    52,    77,    80,    12,    13,
+      14,    80,    80,    17,    18,    19,   352,    80,    80,    80,
+      80,    68,    69,    70,    71,    82,    80,    82,    84,    79,
+      77,    35,    36,    37,    38,    39,    40,    41,    59,    60,
+      61,    62,    63,    64,    65,    79,    50,    79,    84,    80,
+      79,    79,    85,    57,    80,    80,    80,    84,    79,   260,
+     261,   262,   263,   264,   265,   266,    85,    85,    85,    85,
+      85,    85,    85,    85,    85,    85,    85,    84,    84,    84,
+     238,    84,    84,    84,    84,    84,    84,    84,    84,    84,
+      84,    84,    84,    84,    84,    84,    84,    84,    84,    84,
+      84,    84,    84,    84,    84,    84,    84,    84,    84,    84,
+      84,    84,    84,    84,    80,    84,    79,    79,    79,    84,
+      80,    80,    79,    93,    80,    80,   278,    85,    45,   296,
+     176,    85,    85,    85,    85,    85,    85,    82,    85,    85,
+     417,    85,    84,    84,    84,    84,    84,    84,   388,    84,
+      86,    84,    84,    84,    84,    80,    80,    80,    84,    79,
+      24,    80,    80,    85,    79,    79,    -1,    80,    80,    79,
+      -1,    -1,    -1,    84,    70,    84,    84,    84,    84,    84,
+      84,    84,    -1,    85,    84,    84,    84,    84,    80,    84,
+      84,    -1,    -1,   161
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
-       0,    77,     0,    19,    24,    37,    38,    78,    83,    95,
-     122,   123,   128,   129,   141,   162,    70,    70,    70,    70,
-      65,    49,     1,    27,   163,   164,   165,     1,     4,    14,
-      25,    29,    33,    34,    35,    36,    39,    40,    42,    44,
-      45,    46,    58,    64,    66,    96,    97,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   115,   116,     1,    17,    18,    57,
-     142,   143,   144,   145,   146,   147,   148,     1,    11,    12,
-      13,    15,    16,    31,    32,    41,    48,    84,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    70,    70,
-      73,    71,   164,    73,    73,    73,    73,    73,    73,    73,
-      73,    73,    73,    73,    73,    73,    73,    73,    73,    73,
-      71,    97,    10,    73,    73,    73,    71,   143,     6,    73,
-      73,    73,    73,    73,    73,    73,    73,    73,    71,    85,
-       1,    27,    49,   124,   125,   126,   127,     1,    20,    28,
-      30,    43,    59,    60,    61,    62,    66,   130,   131,   132,
-     133,   134,   135,   136,   137,   138,   139,   140,    68,    72,
-      68,    68,    68,    68,    68,    68,    68,    68,    68,    68,
-      67,    67,    80,    68,    80,    68,    68,    68,    72,    70,
-      68,    68,    68,    72,    70,    80,    67,    80,    67,    80,
-      80,    80,    68,    68,    72,    73,    73,    71,   125,    73,
-      73,    73,    73,    73,    73,    73,    73,    73,    71,   131,
-      72,    72,    72,    72,    72,    72,    72,    72,    72,    72,
-      72,    72,    50,    51,    52,    53,    54,    55,    56,    79,
-      80,    72,    72,    72,    72,    72,    72,    21,    26,    30,
-     117,   118,   119,   120,   121,    72,    72,    72,     1,     3,
-       5,    25,    30,    47,    63,   149,   150,   151,   152,   156,
-     157,   158,   159,    72,    72,    72,    72,    72,    72,    72,
-      72,    72,    68,    68,    72,    67,    67,    82,    68,    69,
-      68,    67,    68,    80,    68,    72,    79,    79,    79,    79,
-      79,    79,    79,    73,    73,    73,    71,   118,   153,    73,
-      73,    73,    70,    73,    71,   150,    72,    72,    72,     7,
-       8,     9,    81,    82,    72,    72,    74,    72,    72,    72,
-      72,    72,    68,    68,    68,    72,    73,    67,    68,    68,
-      67,   160,   161,    68,    72,    81,    81,    81,    67,    72,
-      72,    72,    22,    23,   154,   155,    72,    72,    72,    73,
-      71,   161,    72,    72,    72,    75,    68,    72,   155,    72
+       0,    89,     0,    22,    28,    46,    47,    90,    95,   113,
+     140,   141,   146,   147,   160,   184,    82,    82,    82,    82,
+      76,    58,     1,    31,   185,   186,   187,     1,     4,    16,
+      29,    33,    42,    43,    44,    45,    48,    49,    51,    53,
+      54,    55,    67,    75,    77,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,     1,    20,    21,    66,
+     161,   162,   163,   164,   165,   166,   167,     1,    12,    13,
+      14,    17,    18,    19,    35,    36,    37,    38,    39,    40,
+      41,    50,    57,    96,    97,    98,    99,   100,   101,   102,
+     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+      82,    82,    85,    83,   186,    85,    85,    85,    85,    85,
+      85,    85,    85,    85,    85,    85,    85,    85,    85,    85,
+      85,    85,    83,   115,    11,    85,    85,    85,    83,   162,
+       6,    85,    85,    85,    85,    85,    85,    85,    85,    85,
+      85,    85,    85,    85,    85,    85,    83,    97,     1,    31,
+      58,   142,   143,   144,   145,     1,    15,    23,    32,    34,
+      52,    68,    69,    70,    71,    77,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,    80,    84,
+      80,    80,    80,    80,    80,    80,    80,    80,    80,    80,
+      79,    79,    92,    80,    92,    80,    80,    80,    84,    82,
+      80,    80,    80,    84,    82,    92,    79,    92,    79,    92,
+      79,    92,    24,    72,    80,    79,    79,    92,    92,    80,
+      80,    84,    85,    85,    83,   143,    85,    85,    85,    85,
+      85,    85,    85,    85,    85,    85,    83,   149,    84,    84,
+      84,    84,    84,    84,    84,    84,    84,    84,    84,    84,
+      59,    60,    61,    62,    63,    64,    65,    91,    92,    84,
+      84,    84,    84,    84,    84,    25,    30,    34,   135,   136,
+     137,   138,   139,    84,    84,    84,     1,     3,     5,    10,
+      29,    34,    56,    73,    74,    78,   168,   169,   170,   171,
+     175,   176,   177,   178,   179,   180,   181,    84,    84,    84,
+      84,    84,    84,    84,    84,    84,    84,    84,    84,    84,
+      84,    84,    84,    80,    80,    84,    79,    79,    79,    94,
+      80,    81,    80,    79,    80,    92,    80,    84,    91,    91,
+      91,    91,    91,    91,    91,    85,    85,    85,    83,   136,
+     172,    85,    85,    85,    85,    82,    85,    85,    85,    83,
+     169,    84,    84,    84,    84,     7,     8,     9,    93,    94,
+      84,    84,    86,    84,    84,    84,    84,    84,    80,    80,
+      80,    84,    85,    79,    92,    80,    80,    79,   182,   183,
+      79,    80,    80,    84,    93,    93,    93,    79,    84,    84,
+      84,    26,    27,   173,   174,    84,    84,    84,    84,    85,
+      83,   183,    84,    84,    84,    84,    84,    87,    80,    84,
+     174,    84
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    76,    77,    77,    78,    78,    78,    78,    78,    78,
-      79,    79,    80,    80,    80,    80,    80,    80,    80,    80,
-      81,    81,    82,    82,    82,    82,    83,    84,    84,    85,
-      85,    85,    85,    85,    85,    85,    85,    85,    85,    86,
-      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-      96,    97,    97,    97,    97,    97,    97,    97,    97,    97,
+       0,    88,    89,    89,    90,    90,    90,    90,    90,    90,
+      91,    91,    92,    92,    92,    92,    92,    92,    92,    92,
+      93,    93,    94,    94,    94,    94,    95,    96,    96,    97,
       97,    97,    97,    97,    97,    97,    97,    97,    97,    97,
-      98,    99,   100,   101,   102,   103,   104,   105,   106,   107,
-     108,   109,   110,   111,   112,   113,   114,   116,   115,   117,
-     117,   118,   118,   118,   119,   120,   121,   123,   122,   124,
-     124,   125,   125,   125,   126,   127,   129,   128,   130,   130,
-     131,   131,   131,   131,   131,   131,   131,   131,   131,   131,
-     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
-     142,   142,   143,   143,   143,   143,   143,   144,   145,   146,
-     148,   147,   149,   149,   150,   150,   150,   150,   150,   150,
-     150,   151,   153,   152,   154,   154,   155,   155,   156,   157,
-     158,   159,   160,   160,   161,   162,   163,   163,   164,   164,
-     165
+      97,    97,    97,    97,    97,    98,    99,   100,   101,   102,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   114,   115,   115,   115,   115,   115,   115,
+     115,   115,   115,   115,   115,   115,   115,   115,   115,   115,
+     115,   115,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     134,   133,   135,   135,   136,   136,   136,   137,   138,   139,
+     141,   140,   142,   142,   143,   143,   143,   144,   145,   147,
+     146,   148,   148,   149,   149,   149,   149,   149,   149,   149,
+     149,   149,   149,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   161,   162,   162,   162,
+     162,   162,   163,   164,   165,   167,   166,   168,   168,   169,
+     169,   169,   169,   169,   169,   169,   169,   169,   169,   170,
+     172,   171,   173,   173,   174,   174,   175,   176,   177,   178,
+     179,   180,   181,   182,   182,   183,   184,   185,   185,   186,
+     186,   187
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     1,     1,     1,     1,     1,     1,
        0,     1,     2,     3,     3,     3,     3,     3,     3,     3,
        0,     1,     2,     3,     3,     3,     5,     2,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     5,     2,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     0,     6,     2,
-       1,     1,     1,     1,     4,     4,     4,     0,     6,     2,
-       1,     1,     1,     1,     4,     4,     0,     6,     2,     1,
+       4,     5,     2,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       4,     4,     4,     4,     4,     4,     4,     4,     6,     5,
-       2,     1,     1,     1,     1,     1,     1,     4,     4,     4,
-       0,     6,     2,     1,     1,     1,     1,     1,     1,     1,
-       1,     4,     0,     5,     3,     1,     1,     1,     4,     4,
-       4,     5,     2,     1,     4,     5,     2,     1,     1,     1,
-       4
+       1,     1,     1,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       0,     6,     2,     1,     1,     1,     1,     4,     4,     4,
+       0,     6,     2,     1,     1,     1,     1,     4,     4,     0,
+       6,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     6,     5,     2,     1,     1,     1,     1,
+       1,     1,     4,     4,     4,     0,     6,     2,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
+       0,     5,     3,     1,     1,     1,     4,     4,     4,     4,
+       4,     4,     5,     2,     1,     4,     5,     2,     1,     1,
+       1,     4
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1004,55 +1368,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1061,7 +1422,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1084,21 +1445,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1113,8 +1474,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1137,249 +1498,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
 
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -1388,6 +1530,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -1395,43 +1539,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1439,71 +1576,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -1511,30 +1652,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1545,18 +1687,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1584,15 +1737,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1607,7 +1758,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -1627,321 +1778,378 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 10:
-#line 117 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = 0; }
-#line 1634 "config-parser.c" /* yacc.c:1646  */
+  case 10: /* timespec_: %empty  */
+#line 129 "config-parser.y"
+           { (yyval.number) = 0; }
+#line 1785 "config-parser.c"
     break;
 
-  case 12:
-#line 118 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 1640 "config-parser.c" /* yacc.c:1646  */
+  case 12: /* timespec: NUMBER timespec_  */
+#line 130 "config-parser.y"
+                                    { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
+#line 1791 "config-parser.c"
     break;
 
-  case 13:
-#line 119 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 1646 "config-parser.c" /* yacc.c:1646  */
+  case 13: /* timespec: NUMBER SECONDS timespec_  */
+#line 131 "config-parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
+#line 1797 "config-parser.c"
     break;
 
-  case 14:
-#line 120 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 + (yyvsp[0].number); }
-#line 1652 "config-parser.c" /* yacc.c:1646  */
+  case 14: /* timespec: NUMBER MINUTES timespec_  */
+#line 132 "config-parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 + (yyvsp[0].number); }
+#line 1803 "config-parser.c"
     break;
 
-  case 15:
-#line 121 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 + (yyvsp[0].number); }
-#line 1658 "config-parser.c" /* yacc.c:1646  */
+  case 15: /* timespec: NUMBER HOURS timespec_  */
+#line 133 "config-parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 + (yyvsp[0].number); }
+#line 1809 "config-parser.c"
     break;
 
-  case 16:
-#line 122 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 + (yyvsp[0].number); }
-#line 1664 "config-parser.c" /* yacc.c:1646  */
+  case 16: /* timespec: NUMBER DAYS timespec_  */
+#line 134 "config-parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 + (yyvsp[0].number); }
+#line 1815 "config-parser.c"
     break;
 
-  case 17:
-#line 123 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 + (yyvsp[0].number); }
-#line 1670 "config-parser.c" /* yacc.c:1646  */
+  case 17: /* timespec: NUMBER WEEKS timespec_  */
+#line 135 "config-parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 + (yyvsp[0].number); }
+#line 1821 "config-parser.c"
     break;
 
-  case 18:
-#line 124 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 * 4 + (yyvsp[0].number); }
-#line 1676 "config-parser.c" /* yacc.c:1646  */
+  case 18: /* timespec: NUMBER MONTHS timespec_  */
+#line 136 "config-parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 7 * 4 + (yyvsp[0].number); }
+#line 1827 "config-parser.c"
     break;
 
-  case 19:
-#line 125 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 365 + (yyvsp[0].number); }
-#line 1682 "config-parser.c" /* yacc.c:1646  */
+  case 19: /* timespec: NUMBER YEARS timespec_  */
+#line 137 "config-parser.y"
+                                    { (yyval.number) = (yyvsp[-2].number) * 60 * 60 * 24 * 365 + (yyvsp[0].number); }
+#line 1833 "config-parser.c"
     break;
 
-  case 20:
-#line 128 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = 0; }
-#line 1688 "config-parser.c" /* yacc.c:1646  */
+  case 20: /* sizespec_: %empty  */
+#line 140 "config-parser.y"
+           { (yyval.number) = 0; }
+#line 1839 "config-parser.c"
     break;
 
-  case 22:
-#line 129 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
-#line 1694 "config-parser.c" /* yacc.c:1646  */
+  case 22: /* sizespec: NUMBER sizespec_  */
+#line 141 "config-parser.y"
+                                   { (yyval.number) = (yyvsp[-1].number) + (yyvsp[0].number); }
+#line 1845 "config-parser.c"
     break;
 
-  case 23:
-#line 130 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
-#line 1700 "config-parser.c" /* yacc.c:1646  */
+  case 23: /* sizespec: NUMBER BYTES sizespec_  */
+#line 142 "config-parser.y"
+                                   { (yyval.number) = (yyvsp[-2].number) + (yyvsp[0].number); }
+#line 1851 "config-parser.c"
     break;
 
-  case 24:
-#line 131 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) * 1024 + (yyvsp[0].number); }
-#line 1706 "config-parser.c" /* yacc.c:1646  */
+  case 24: /* sizespec: NUMBER KBYTES sizespec_  */
+#line 143 "config-parser.y"
+                                   { (yyval.number) = (yyvsp[-2].number) * 1024 + (yyvsp[0].number); }
+#line 1857 "config-parser.c"
     break;
 
-  case 25:
-#line 132 "config-parser.y" /* yacc.c:1646  */
-    { (yyval.number) = (yyvsp[-2].number) * 1024 * 1024 + (yyvsp[0].number); }
-#line 1712 "config-parser.c" /* yacc.c:1646  */
+  case 25: /* sizespec: NUMBER MBYTES sizespec_  */
+#line 144 "config-parser.y"
+                                   { (yyval.number) = (yyvsp[-2].number) * 1024 * 1024 + (yyvsp[0].number); }
+#line 1863 "config-parser.c"
     break;
 
-  case 39:
-#line 154 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 45: /* options_negcache: NEGCACHE '=' timespec ';'  */
+#line 172 "config-parser.y"
+{
   OptionsItem->negcache = (yyvsp[-1].number);
 }
-#line 1720 "config-parser.c" /* yacc.c:1646  */
+#line 1871 "config-parser.c"
     break;
 
-  case 40:
-#line 159 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 46: /* options_negcache_rebuild: NEGCACHE_REBUILD '=' timespec ';'  */
+#line 177 "config-parser.y"
+{
   OptionsItem->negcache_rebuild = (yyvsp[-1].number);
 }
-#line 1728 "config-parser.c" /* yacc.c:1646  */
+#line 1879 "config-parser.c"
     break;
 
-  case 41:
-#line 164 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 47: /* options_negcache_file: NEGCACHE_FILE '=' STRING ';'  */
+#line 182 "config-parser.y"
+{
+  xfree(OptionsItem->negcache_file);
+  OptionsItem->negcache_file = xstrdup((yyvsp[-1].string));
+}
+#line 1888 "config-parser.c"
+    break;
+
+  case 48: /* options_negcache_snapshot: NEGCACHE_SNAPSHOT '=' timespec ';'  */
+#line 188 "config-parser.y"
+{
+  OptionsItem->negcache_snapshot = (yyvsp[-1].number);
+}
+#line 1896 "config-parser.c"
+    break;
+
+  case 49: /* options_negcache_backend: NEGCACHE_BACKEND '=' TRIE ';'  */
+#line 193 "config-parser.y"
+{
+  OptionsItem->negcache_backend = NEGCACHE_BACKEND_TRIE;
+}
+#line 1904 "config-parser.c"
+    break;
+
+  case 50: /* options_negcache_backend: NEGCACHE_BACKEND '=' HASH ';'  */
+#line 196 "config-parser.y"
+{
+  OptionsItem->negcache_backend = NEGCACHE_BACKEND_HASH;
+}
+#line 1912 "config-parser.c"
+    break;
+
+  case 51: /* options_negcache_ipv4_prefix: NEGCACHE_IPV4_PREFIX '=' NUMBER ';'  */
+#line 201 "config-parser.y"
+{
+  OptionsItem->negcache_ipv4_prefix = (yyvsp[-1].number);
+}
+#line 1920 "config-parser.c"
+    break;
+
+  case 52: /* options_negcache_ipv6_prefix: NEGCACHE_IPV6_PREFIX '=' NUMBER ';'  */
+#line 206 "config-parser.y"
+{
+  OptionsItem->negcache_ipv6_prefix = (yyvsp[-1].number);
+}
+#line 1928 "config-parser.c"
+    break;
+
+  case 53: /* options_pidfile: PIDFILE '=' STRING ';'  */
+#line 211 "config-parser.y"
+{
   xfree(OptionsItem->pidfile);
   OptionsItem->pidfile = xstrdup((yyvsp[-1].string));
 }
-#line 1737 "config-parser.c" /* yacc.c:1646  */
+#line 1937 "config-parser.c"
     break;
 
-  case 42:
-#line 170 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 54: /* options_dns_fdlimit: DNS_FDLIMIT '=' NUMBER ';'  */
+#line 217 "config-parser.y"
+{
   OptionsItem->dns_fdlimit = (yyvsp[-1].number);
 }
-#line 1745 "config-parser.c" /* yacc.c:1646  */
+#line 1945 "config-parser.c"
     break;
 
-  case 43:
-#line 175 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 55: /* options_dns_timeout: DNS_TIMEOUT '=' timespec ';'  */
+#line 222 "config-parser.y"
+{
   OptionsItem->dns_timeout = (yyvsp[-1].number);
 }
-#line 1753 "config-parser.c" /* yacc.c:1646  */
+#line 1953 "config-parser.c"
     break;
 
-  case 44:
-#line 180 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 56: /* options_dns_udp_size: DNS_UDP_SIZE '=' NUMBER ';'  */
+#line 227 "config-parser.y"
+{
+  OptionsItem->dns_udp_size = (yyvsp[-1].number);
+}
+#line 1961 "config-parser.c"
+    break;
+
+  case 57: /* options_scanlog: SCANLOG '=' STRING ';'  */
+#line 232 "config-parser.y"
+{
   xfree(OptionsItem->scanlog);
   OptionsItem->scanlog = xstrdup((yyvsp[-1].string));
 }
-#line 1762 "config-parser.c" /* yacc.c:1646  */
+#line 1970 "config-parser.c"
     break;
 
-  case 45:
-#line 186 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 58: /* options_command_queue_size: COMMAND_QUEUE_SIZE '=' NUMBER ';'  */
+#line 238 "config-parser.y"
+{
   OptionsItem->command_queue_size = (yyvsp[-1].number);
 }
-#line 1770 "config-parser.c" /* yacc.c:1646  */
+#line 1978 "config-parser.c"
     break;
 
-  case 46:
-#line 191 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 59: /* options_command_interval: COMMAND_INTERVAL '=' timespec ';'  */
+#line 243 "config-parser.y"
+{
   OptionsItem->command_interval = (yyvsp[-1].number);
 }
-#line 1778 "config-parser.c" /* yacc.c:1646  */
+#line 1986 "config-parser.c"
     break;
 
-  case 47:
-#line 196 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 60: /* options_command_timeout: COMMAND_TIMEOUT '=' timespec ';'  */
+#line 248 "config-parser.y"
+{
   OptionsItem->command_timeout = (yyvsp[-1].number);
 }
-#line 1786 "config-parser.c" /* yacc.c:1646  */
+#line 1994 "config-parser.c"
     break;
 
-  case 70:
-#line 228 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 83: /* irc_away: AWAY '=' STRING ';'  */
+#line 280 "config-parser.y"
+{
   xfree(IRCItem->away);
   IRCItem->away = xstrdup((yyvsp[-1].string));
 }
-#line 1795 "config-parser.c" /* yacc.c:1646  */
+#line 2003 "config-parser.c"
     break;
 
-  case 71:
-#line 234 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 84: /* irc_kline: KLINE '=' STRING ';'  */
+#line 286 "config-parser.y"
+{
   xfree(IRCItem->kline);
   IRCItem->kline = xstrdup((yyvsp[-1].string));
 }
-#line 1804 "config-parser.c" /* yacc.c:1646  */
+#line 2012 "config-parser.c"
     break;
 
-  case 72:
-#line 240 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 85: /* irc_mode: MODE '=' STRING ';'  */
+#line 292 "config-parser.y"
+{
   xfree(IRCItem->mode);
   IRCItem->mode = xstrdup((yyvsp[-1].string));
 }
-#line 1813 "config-parser.c" /* yacc.c:1646  */
+#line 2021 "config-parser.c"
     break;
 
-  case 73:
-#line 246 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 86: /* irc_nick: NICK '=' STRING ';'  */
+#line 298 "config-parser.y"
+{
   xfree(IRCItem->nick);
   IRCItem->nick = xstrdup((yyvsp[-1].string));
 }
-#line 1822 "config-parser.c" /* yacc.c:1646  */
+#line 2030 "config-parser.c"
     break;
 
-  case 74:
-#line 252 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 87: /* irc_nickserv: NICKSERV '=' STRING ';'  */
+#line 304 "config-parser.y"
+{
   xfree(IRCItem->nickserv);
   IRCItem->nickserv = xstrdup((yyvsp[-1].string));
 }
-#line 1831 "config-parser.c" /* yacc.c:1646  */
+#line 2039 "config-parser.c"
     break;
 
-  case 75:
-#line 258 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 88: /* irc_oper: OPER '=' STRING ';'  */
+#line 310 "config-parser.y"
+{
   xfree(IRCItem->oper);
   IRCItem->oper = xstrdup((yyvsp[-1].string));
 }
-#line 1840 "config-parser.c" /* yacc.c:1646  */
+#line 2048 "config-parser.c"
     break;
 
-  case 76:
-#line 264 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 89: /* irc_password: PASSWORD '=' STRING ';'  */
+#line 316 "config-parser.y"
+{
   xfree(IRCItem->password);
   IRCItem->password = xstrdup((yyvsp[-1].string));
 }
-#line 1849 "config-parser.c" /* yacc.c:1646  */
+#line 2057 "config-parser.c"
     break;
 
-  case 77:
-#line 270 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 90: /* irc_perform: PERFORM '=' STRING ';'  */
+#line 322 "config-parser.y"
+{
   node_t *node;
 
   node = node_create(xstrdup((yyvsp[-1].string)));
   list_add(IRCItem->performs, node);
 }
-#line 1860 "config-parser.c" /* yacc.c:1646  */
+#line 2068 "config-parser.c"
     break;
 
-  case 78:
-#line 278 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 91: /* irc_notice: NOTICE '=' STRING ';'  */
+#line 330 "config-parser.y"
+{
   node_t *node;
 
   node = node_create(xstrdup((yyvsp[-1].string)));
   list_add(IRCItem->notices, node);
 }
-#line 1871 "config-parser.c" /* yacc.c:1646  */
+#line 2079 "config-parser.c"
     break;
 
-  case 79:
-#line 286 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 92: /* irc_port: PORT '=' NUMBER ';'  */
+#line 338 "config-parser.y"
+{
   IRCItem->port = (yyvsp[-1].number);
 }
-#line 1879 "config-parser.c" /* yacc.c:1646  */
+#line 2087 "config-parser.c"
     break;
 
-  case 80:
-#line 291 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 93: /* irc_readtimeout: READTIMEOUT '=' timespec ';'  */
+#line 343 "config-parser.y"
+{
   IRCItem->readtimeout = (yyvsp[-1].number);
 }
-#line 1887 "config-parser.c" /* yacc.c:1646  */
+#line 2095 "config-parser.c"
     break;
 
-  case 81:
-#line 296 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 94: /* irc_reconnectinterval: RECONNECTINTERVAL '=' timespec ';'  */
+#line 348 "config-parser.y"
+{
   IRCItem->reconnectinterval = (yyvsp[-1].number);
 }
-#line 1895 "config-parser.c" /* yacc.c:1646  */
+#line 2103 "config-parser.c"
     break;
 
-  case 82:
-#line 301 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 95: /* irc_realname: REALNAME '=' STRING ';'  */
+#line 353 "config-parser.y"
+{
   xfree(IRCItem->realname);
   IRCItem->realname = xstrdup((yyvsp[-1].string));
 }
-#line 1904 "config-parser.c" /* yacc.c:1646  */
+#line 2112 "config-parser.c"
     break;
 
-  case 83:
-#line 307 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 96: /* irc_server: SERVER '=' STRING ';'  */
+#line 359 "config-parser.y"
+{
   xfree(IRCItem->server);
   IRCItem->server = xstrdup((yyvsp[-1].string));
 }
-#line 1913 "config-parser.c" /* yacc.c:1646  */
+#line 2121 "config-parser.c"
     break;
 
-  case 84:
-#line 313 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 97: /* irc_username: USERNAME '=' STRING ';'  */
+#line 365 "config-parser.y"
+{
   xfree(IRCItem->username);
   IRCItem->username = xstrdup((yyvsp[-1].string));
 }
-#line 1922 "config-parser.c" /* yacc.c:1646  */
+#line 2130 "config-parser.c"
     break;
 
-  case 85:
-#line 319 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 98: /* irc_vhost: VHOST '=' STRING ';'  */
+#line 371 "config-parser.y"
+{
   xfree(IRCItem->vhost);
   IRCItem->vhost = xstrdup((yyvsp[-1].string));
 }
-#line 1931 "config-parser.c" /* yacc.c:1646  */
+#line 2139 "config-parser.c"
     break;
 
-  case 86:
-#line 325 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 99: /* irc_connregex: CONNREGEX '=' STRING ';'  */
+#line 377 "config-parser.y"
+{
   xfree(IRCItem->connregex);
   IRCItem->connregex = xstrdup((yyvsp[-1].string));
 }
-#line 1940 "config-parser.c" /* yacc.c:1646  */
+#line 2148 "config-parser.c"
     break;
 
-  case 87:
-#line 333 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 100: /* $@1: %empty  */
+#line 385 "config-parser.y"
+{
   node_t *node;
   struct ChannelConf *item;
 
@@ -1955,45 +2163,45 @@ yyreduce:
   list_add(IRCItem->channels, node);
   tmp = item;
 }
-#line 1959 "config-parser.c" /* yacc.c:1646  */
+#line 2167 "config-parser.c"
     break;
 
-  case 94:
-#line 357 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 107: /* channel_name: NAME '=' STRING ';'  */
+#line 409 "config-parser.y"
+{
   struct ChannelConf *item = tmp;
 
   xfree(item->name);
   item->name = xstrdup((yyvsp[-1].string));
 }
-#line 1970 "config-parser.c" /* yacc.c:1646  */
+#line 2178 "config-parser.c"
     break;
 
-  case 95:
-#line 365 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 108: /* channel_key: KEY '=' STRING ';'  */
+#line 417 "config-parser.y"
+{
   struct ChannelConf *item = tmp;
 
   xfree(item->key);
   item->key = xstrdup((yyvsp[-1].string));
 }
-#line 1981 "config-parser.c" /* yacc.c:1646  */
+#line 2189 "config-parser.c"
     break;
 
-  case 96:
-#line 373 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 109: /* channel_invite: INVITE '=' STRING ';'  */
+#line 425 "config-parser.y"
+{
   struct ChannelConf *item = tmp;
 
   xfree(item->invite);
   item->invite = xstrdup((yyvsp[-1].string));
 }
-#line 1992 "config-parser.c" /* yacc.c:1646  */
+#line 2200 "config-parser.c"
     break;
 
-  case 97:
-#line 383 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 110: /* $@2: %empty  */
+#line 435 "config-parser.y"
+{
   node_t *node;
   struct UserConf *item;
 
@@ -2006,12 +2214,12 @@ yyreduce:
   list_add(UserItemList, node);
   tmp = item;
 }
-#line 2010 "config-parser.c" /* yacc.c:1646  */
+#line 2218 "config-parser.c"
     break;
 
-  case 104:
-#line 406 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 117: /* user_mask: MASK '=' STRING ';'  */
+#line 458 "config-parser.y"
+{
   struct UserConf *item = tmp;
   node_t *node;
 
@@ -2019,12 +2227,12 @@ yyreduce:
 
   list_add(item->masks, node);
 }
-#line 2023 "config-parser.c" /* yacc.c:1646  */
+#line 2231 "config-parser.c"
     break;
 
-  case 105:
-#line 416 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 118: /* user_scanner: SCANNER '=' STRING ';'  */
+#line 468 "config-parser.y"
+{
   struct UserConf *item = tmp;
   node_t *node;
 
@@ -2032,12 +2240,12 @@ yyreduce:
 
   list_add(item->scanners, node);
 }
-#line 2036 "config-parser.c" /* yacc.c:1646  */
+#line 2244 "config-parser.c"
     break;
 
-  case 106:
-#line 428 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 119: /* $@3: %empty  */
+#line 480 "config-parser.y"
+{
   node_t *node;
   struct ScannerConf *item, *olditem;
 
@@ -2056,6 +2264,7 @@ yyreduce:
     item->target_port = olditem->target_port;
     item->timeout = olditem->timeout;
     item->max_read = olditem->max_read;
+    item->connect_rate = olditem->connect_rate;
     item->target_string = olditem->target_string;
     item->target_string_created = 0;
   }
@@ -2067,6 +2276,7 @@ yyreduce:
     item->target_port = 6667;
     item->timeout = 30;
     item->max_read = 4096;
+    item->connect_rate = 0;
     item->target_string = list_create();
     item->target_string_created = 1;
   }
@@ -2078,45 +2288,45 @@ yyreduce:
   list_add(ScannerItemList, node);
   tmp = item;
 }
-#line 2082 "config-parser.c" /* yacc.c:1646  */
+#line 2292 "config-parser.c"
     break;
 
-  case 120:
-#line 486 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 134: /* scanner_name: NAME '=' STRING ';'  */
+#line 541 "config-parser.y"
+{
   struct ScannerConf *item = tmp;
 
   xfree(item->name);
   item->name = xstrdup((yyvsp[-1].string));
 }
-#line 2093 "config-parser.c" /* yacc.c:1646  */
+#line 2303 "config-parser.c"
     break;
 
-  case 121:
-#line 494 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 135: /* scanner_vhost: VHOST '=' STRING ';'  */
+#line 549 "config-parser.y"
+{
   struct ScannerConf *item = tmp;
 
   xfree(item->vhost);
   item->vhost = xstrdup((yyvsp[-1].string));
 }
-#line 2104 "config-parser.c" /* yacc.c:1646  */
+#line 2314 "config-parser.c"
     break;
 
-  case 122:
-#line 502 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 136: /* scanner_target_ip: TARGET_IP '=' STRING ';'  */
+#line 557 "config-parser.y"
+{
   struct ScannerConf *item = tmp;
 
   xfree(item->target_ip);
   item->target_ip = xstrdup((yyvsp[-1].string));
 }
-#line 2115 "config-parser.c" /* yacc.c:1646  */
+#line 2325 "config-parser.c"
     break;
 
-  case 123:
-#line 510 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 137: /* scanner_target_string: TARGET_STRING '=' STRING ';'  */
+#line 565 "config-parser.y"
+{
   struct ScannerConf *item = tmp;
   node_t *node;
 
@@ -2130,52 +2340,62 @@ yyreduce:
 
   list_add(item->target_string, node);
 }
-#line 2134 "config-parser.c" /* yacc.c:1646  */
+#line 2344 "config-parser.c"
     break;
 
-  case 124:
-#line 526 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 138: /* scanner_fd: FD '=' NUMBER ';'  */
+#line 581 "config-parser.y"
+{
   struct ScannerConf *item = tmp;
 
   item->fd = (yyvsp[-1].number);
 }
-#line 2144 "config-parser.c" /* yacc.c:1646  */
+#line 2354 "config-parser.c"
     break;
 
-  case 125:
-#line 533 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 139: /* scanner_target_port: TARGET_PORT '=' NUMBER ';'  */
+#line 588 "config-parser.y"
+{
   struct ScannerConf *item = tmp;
 
   item->target_port = (yyvsp[-1].number);
 }
-#line 2154 "config-parser.c" /* yacc.c:1646  */
+#line 2364 "config-parser.c"
     break;
 
-  case 126:
-#line 540 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 140: /* scanner_timeout: TIMEOUT '=' timespec ';'  */
+#line 595 "config-parser.y"
+{
   struct ScannerConf *item = tmp;
 
   item->timeout = (yyvsp[-1].number);
 }
-#line 2164 "config-parser.c" /* yacc.c:1646  */
+#line 2374 "config-parser.c"
     break;
 
-  case 127:
-#line 547 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 141: /* scanner_max_read: MAX_READ '=' sizespec ';'  */
+#line 602 "config-parser.y"
+{
   struct ScannerConf *item = tmp;
 
   item->max_read = (yyvsp[-1].number);
 }
-#line 2174 "config-parser.c" /* yacc.c:1646  */
+#line 2384 "config-parser.c"
     break;
 
-  case 128:
-#line 554 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 142: /* scanner_connect_rate: CONNECT_RATE '=' NUMBER ';'  */
+#line 609 "config-parser.y"
+{
+  struct ScannerConf *item = tmp;
+
+  item->connect_rate = (yyvsp[-1].number);
+}
+#line 2394 "config-parser.c"
+    break;
+
+  case 143: /* scanner_protocol: PROTOCOL '=' PROTOCOLTYPE ':' NUMBER ';'  */
+#line 616 "config-parser.y"
+{
   struct ProtocolConf *item;
   struct ScannerConf *item2;
   node_t *node;
@@ -2189,39 +2409,39 @@ yyreduce:
   node = node_create(item);
   list_add(item2->protocols, node);
 }
-#line 2193 "config-parser.c" /* yacc.c:1646  */
+#line 2413 "config-parser.c"
     break;
 
-  case 137:
-#line 583 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 152: /* opm_dnsbl_from: DNSBL_FROM '=' STRING ';'  */
+#line 645 "config-parser.y"
+{
   xfree(OpmItem->dnsbl_from);
   OpmItem->dnsbl_from = xstrdup((yyvsp[-1].string));
 }
-#line 2202 "config-parser.c" /* yacc.c:1646  */
+#line 2422 "config-parser.c"
     break;
 
-  case 138:
-#line 589 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 153: /* opm_dnsbl_to: DNSBL_TO '=' STRING ';'  */
+#line 651 "config-parser.y"
+{
   xfree(OpmItem->dnsbl_to);
   OpmItem->dnsbl_to = xstrdup((yyvsp[-1].string));
 }
-#line 2211 "config-parser.c" /* yacc.c:1646  */
+#line 2431 "config-parser.c"
     break;
 
-  case 139:
-#line 595 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 154: /* opm_sendmail: SENDMAIL '=' STRING ';'  */
+#line 657 "config-parser.y"
+{
   xfree(OpmItem->sendmail);
   OpmItem->sendmail = xstrdup((yyvsp[-1].string));
 }
-#line 2220 "config-parser.c" /* yacc.c:1646  */
+#line 2440 "config-parser.c"
     break;
 
-  case 140:
-#line 603 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 155: /* $@4: %empty  */
+#line 665 "config-parser.y"
+{
   node_t *node;
   struct BlacklistConf *item;
 
@@ -2230,6 +2450,7 @@ yyreduce:
   item->kline = xstrdup("");
   item->ipv4 = 1;
   item->ban_unknown = 0;
+  item->cache_ttl = 300;
   item->type = A_BITMASK;
   item->reply = list_create();
 
@@ -2238,65 +2459,65 @@ yyreduce:
 
   tmp = item;
 }
-#line 2242 "config-parser.c" /* yacc.c:1646  */
+#line 2463 "config-parser.c"
     break;
 
-  case 151:
-#line 634 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 169: /* blacklist_name: NAME '=' STRING ';'  */
+#line 700 "config-parser.y"
+{
   struct BlacklistConf *item = tmp;
 
   xfree(item->name);
   item->name = xstrdup((yyvsp[-1].string));
 }
-#line 2253 "config-parser.c" /* yacc.c:1646  */
+#line 2474 "config-parser.c"
     break;
 
-  case 152:
-#line 642 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 170: /* $@5: %empty  */
+#line 708 "config-parser.y"
+{
   struct BlacklistConf *item = tmp;
 
   item->ipv4 = 0;
   item->ipv6 = 0;
 }
-#line 2264 "config-parser.c" /* yacc.c:1646  */
+#line 2485 "config-parser.c"
     break;
 
-  case 156:
-#line 651 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 174: /* blacklist_address_family_item: IPV4  */
+#line 717 "config-parser.y"
+{
   struct BlacklistConf *item = tmp;
 
   item->ipv4 = 1;
 }
-#line 2274 "config-parser.c" /* yacc.c:1646  */
+#line 2495 "config-parser.c"
     break;
 
-  case 157:
-#line 656 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 175: /* blacklist_address_family_item: IPV6  */
+#line 722 "config-parser.y"
+{
   struct BlacklistConf *item = tmp;
 
   item->ipv6 = 1;
 }
-#line 2284 "config-parser.c" /* yacc.c:1646  */
+#line 2505 "config-parser.c"
     break;
 
-  case 158:
-#line 663 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 176: /* blacklist_kline: KLINE '=' STRING ';'  */
+#line 729 "config-parser.y"
+{
   struct BlacklistConf *item = tmp;
 
   xfree(item->kline);
   item->kline = xstrdup((yyvsp[-1].string));
 }
-#line 2295 "config-parser.c" /* yacc.c:1646  */
+#line 2516 "config-parser.c"
     break;
 
-  case 159:
-#line 671 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 177: /* blacklist_type: TYPE '=' STRING ';'  */
+#line 737 "config-parser.y"
+{
   struct BlacklistConf *item = tmp;
 
   if (strcmp("A record bitmask", (yyvsp[-1].string)) == 0)
@@ -2306,22 +2527,53 @@ yyreduce:
   else
     yyerror("Unknown blacklist type defined");
 }
-#line 2310 "config-parser.c" /* yacc.c:1646  */
+#line 2531 "config-parser.c"
     break;
 
-  case 160:
-#line 683 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 178: /* blacklist_ban_unknown: BAN_UNKNOWN '=' NUMBER ';'  */
+#line 749 "config-parser.y"
+{
   struct BlacklistConf *item = tmp;
 
   item->ban_unknown = (yyvsp[-1].number);
 }
-#line 2320 "config-parser.c" /* yacc.c:1646  */
+#line 2541 "config-parser.c"
     break;
 
-  case 164:
-#line 695 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 179: /* blacklist_txt_reason: TXT_REASON '=' NUMBER ';'  */
+#line 756 "config-parser.y"
+{
+  struct BlacklistConf *item = tmp;
+
+  item->txt_reason = (yyvsp[-1].number);
+}
+#line 2551 "config-parser.c"
+    break;
+
+  case 180: /* blacklist_cache_ttl: CACHE_TTL '=' timespec ';'  */
+#line 763 "config-parser.y"
+{
+  struct BlacklistConf *item = tmp;
+
+  item->cache_ttl = (yyvsp[-1].number);
+}
+#line 2561 "config-parser.c"
+    break;
+
+  case 181: /* blacklist_zone_file: ZONE_FILE '=' STRING ';'  */
+#line 770 "config-parser.y"
+{
+  struct BlacklistConf *item = tmp;
+
+  xfree(item->zone_file);
+  item->zone_file = xstrdup((yyvsp[-1].string));
+}
+#line 2572 "config-parser.c"
+    break;
+
+  case 185: /* blacklist_reply_item: NUMBER '=' STRING ';'  */
+#line 783 "config-parser.y"
+{
   struct BlacklistReplyConf *item;
   struct BlacklistConf *blacklist = tmp;
   node_t *node;
@@ -2333,22 +2585,23 @@ yyreduce:
   node = node_create(item);
   list_add(blacklist->reply, node);
 }
-#line 2337 "config-parser.c" /* yacc.c:1646  */
+#line 2589 "config-parser.c"
     break;
 
-  case 170:
-#line 719 "config-parser.y" /* yacc.c:1646  */
-    {
+  case 191: /* exempt_mask: MASK '=' STRING ';'  */
+#line 807 "config-parser.y"
+{
   node_t *node;
   node = node_create(xstrdup((yyvsp[-1].string)));
 
   list_add(ExemptItem->masks, node);
 }
-#line 2348 "config-parser.c" /* yacc.c:1646  */
+#line 2600 "config-parser.c"
     break;
 
 
-#line 2352 "config-parser.c" /* yacc.c:1646  */
+#line 2604 "config-parser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2362,25 +2615,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -2391,50 +2642,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2463,12 +2678,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -2485,13 +2699,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -2505,7 +2720,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2517,7 +2732,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2528,26 +2743,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -2563,18 +2782,16 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 726 "config-parser.y" /* yacc.c:1906  */
+
+#line 814 "config-parser.y"
 
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_CONFIG_PARSER_H_INCLUDED
 # define YY_YY_CONFIG_PARSER_H_INCLUDED
 /* Debug traces.  */
@@ -40,81 +45,102 @@
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    ADDRESS_FAMILY = 258,
-    AWAY = 259,
-    BAN_UNKNOWN = 260,
-    BLACKLIST = 261,
-    BYTES = 262,
-    KBYTES = 263,
-    MBYTES = 264,
-    CHANNEL = 265,
-    COMMAND_INTERVAL = 266,
-    COMMAND_QUEUE_SIZE = 267,
-    COMMAND_TIMEOUT = 268,
-    CONNREGEX = 269,
-    DNS_FDLIMIT = 270,
-    DNS_TIMEOUT = 271,
-    DNSBL_FROM = 272,
-    DNSBL_TO = 273,
-    EXEMPT = 274,
-    FD = 275,
-    INVITE = 276,
-    IPV4 = 277,
-    IPV6 = 278,
-    IRC = 279,
-    KLINE = 280,
-    KEY = 281,
-    MASK = 282,
-    MAX_READ = 283,
-    MODE = 284,
-    NAME = 285,
-    NEGCACHE = 286,
-    NEGCACHE_REBUILD = 287,
-    NICK = 288,
-    NICKSERV = 289,
-    NOTICE = 290,
-    OPER = 291,
-    OPM = 292,
-    OPTIONS = 293,
-    PASSWORD = 294,
-    PERFORM = 295,
-    PIDFILE = 296,
-    PORT = 297,
-    PROTOCOL = 298,
-    READTIMEOUT = 299,
-    REALNAME = 300,
-    RECONNECTINTERVAL = 301,
-    REPLY = 302,
-    SCANLOG = 303,
-    SCANNER = 304,
-    SECONDS = 305,
-    MINUTES = 306,
-    HOURS = 307,
-    DAYS = 308,
-    WEEKS = 309,
-    MONTHS = 310,
-    YEARS = 311,
-    SENDMAIL = 312,
-    SERVER = 313,
-    TARGET_IP = 314,
-    TARGET_PORT = 315,
-    TARGET_STRING = 316,
-    TIMEOUT = 317,
-    TYPE = 318,
-    USERNAME = 319,
-    USER = 320,
-    VHOST = 321,
-    NUMBER = 322,
-    STRING = 323,
-    PROTOCOLTYPE = 324
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ADDRESS_FAMILY = 258,          /* ADDRESS_FAMILY  */
+    AWAY = 259,                    /* AWAY  */
+    BAN_UNKNOWN = 260,             /* BAN_UNKNOWN  */
+    BLACKLIST = 261,               /* BLACKLIST  */
+    BYTES = 262,                   /* BYTES  */
+    KBYTES = 263,                  /* KBYTES  */
+    MBYTES = 264,                  /* MBYTES  */
+    CACHE_TTL = 265,               /* CACHE_TTL  */
+    CHANNEL = 266,                 /* CHANNEL  */
+    COMMAND_INTERVAL = 267,        /* COMMAND_INTERVAL  */
+    COMMAND_QUEUE_SIZE = 268,      /* COMMAND_QUEUE_SIZE  */
+    COMMAND_TIMEOUT = 269,         /* COMMAND_TIMEOUT  */
+    CONNECT_RATE = 270,            /* CONNECT_RATE  */
+    CONNREGEX = 271,               /* CONNREGEX  */
+    DNS_FDLIMIT = 272,             /* DNS_FDLIMIT  */
+    DNS_TIMEOUT = 273,             /* DNS_TIMEOUT  */
+    DNS_UDP_SIZE = 274,            /* DNS_UDP_SIZE  */
+    DNSBL_FROM = 275,              /* DNSBL_FROM  */
+    DNSBL_TO = 276,                /* DNSBL_TO  */
+    EXEMPT = 277,                  /* EXEMPT  */
+    FD = 278,                      /* FD  */
+    HASH = 279,                    /* HASH  */
+    INVITE = 280,                  /* INVITE  */
+    IPV4 = 281,                    /* IPV4  */
+    IPV6 = 282,                    /* IPV6  */
+    IRC = 283,                     /* IRC  */
+    KLINE = 284,                   /* KLINE  */
+    KEY = 285,                     /* KEY  */
+    MASK = 286,                    /* MASK  */
+    MAX_READ = 287,                /* MAX_READ  */
+    MODE = 288,                    /* MODE  */
+    NAME = 289,                    /* NAME  */
+    NEGCACHE = 290,                /* NEGCACHE  */
+    NEGCACHE_BACKEND = 291,        /* NEGCACHE_BACKEND  */
+    NEGCACHE_FILE = 292,           /* NEGCACHE_FILE  */
+    NEGCACHE_IPV4_PREFIX = 293,    /* NEGCACHE_IPV4_PREFIX  */
+    NEGCACHE_IPV6_PREFIX = 294,    /* NEGCACHE_IPV6_PREFIX  */
+    NEGCACHE_REBUILD = 295,        /* NEGCACHE_REBUILD  */
+    NEGCACHE_SNAPSHOT = 296,       /* NEGCACHE_SNAPSHOT  */
+    NICK = 297,                    /* NICK  */
+    NICKSERV = 298,                /* NICKSERV  */
+    NOTICE = 299,                  /* NOTICE  */
+    OPER = 300,                    /* OPER  */
+    OPM = 301,                     /* OPM  */
+    OPTIONS = 302,                 /* OPTIONS  */
+    PASSWORD = 303,                /* PASSWORD  */
+    PERFORM = 304,                 /* PERFORM  */
+    PIDFILE = 305,                 /* PIDFILE  */
+    PORT = 306,                    /* PORT  */
+    PROTOCOL = 307,                /* PROTOCOL  */
+    READTIMEOUT = 308,             /* READTIMEOUT  */
+    REALNAME = 309,                /* REALNAME  */
+    RECONNECTINTERVAL = 310,       /* RECONNECTINTERVAL  */
+    REPLY = 311,                   /* REPLY  */
+    SCANLOG = 312,                 /* SCANLOG  */
+    SCANNER = 313,                 /* SCANNER  */
+    SECONDS = 314,                 /* SECONDS  */
+    MINUTES = 315,                 /* MINUTES  */
+    HOURS = 316,                   /* HOURS  */
+    DAYS = 317,                    /* DAYS  */
+    WEEKS = 318,                   /* WEEKS  */
+    MONTHS = 319,                  /* MONTHS  */
+    YEARS = 320,                   /* YEARS  */
+    SENDMAIL = 321,                /* SENDMAIL  */
+    SERVER = 322,                  /* SERVER  */
+    TARGET_IP = 323,               /* TARGET_IP  */
+    TARGET_PORT = 324,             /* TARGET_PORT  */
+    TARGET_STRING = 325,           /* TARGET_STRING  */
+    TIMEOUT = 326,                 /* TIMEOUT  */
+    TRIE = 327,                    /* TRIE  */
+    TXT_REASON = 328,              /* TXT_REASON  */
+    TYPE = 329,                    /* TYPE  */
+    USERNAME = 330,                /* USERNAME  */
+    USER = 331,                    /* USER  */
+    VHOST = 332,                   /* VHOST  */
+    ZONE_FILE = 333,               /* ZONE_FILE  */
+    NUMBER = 334,                  /* NUMBER  */
+    STRING = 335,                  /* STRING  */
+    PROTOCOLTYPE = 336             /* PROTOCOLTYPE  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define ADDRESS_FAMILY 258
 #define AWAY 259
 #define BAN_UNKNOWN 260
@@ -122,80 +148,91 @@ extern int yydebug;
 #define BYTES 262
 #define KBYTES 263
 #define MBYTES 264
-#define CHANNEL 265
-#define COMMAND_INTERVAL 266
-#define COMMAND_QUEUE_SIZE 267
-#define COMMAND_TIMEOUT 268
-#define CONNREGEX 269
-#define DNS_FDLIMIT 270
-#define DNS_TIMEOUT 271
-#define DNSBL_FROM 272
-#define DNSBL_TO 273
-#define EXEMPT 274
-#define FD 275
-#define INVITE 276
-#define IPV4 277
-#define IPV6 278
-#define IRC 279
-#define KLINE 280
-#define KEY 281
-#define MASK 282
-#define MAX_READ 283
-#define MODE 284
-#define NAME 285
-#define NEGCACHE 286
-#define NEGCACHE_REBUILD 287
-#define NICK 288
-#define NICKSERV 289
-#define NOTICE 290
-#define OPER 291
-#define OPM 292
-#define OPTIONS 293
-#define PASSWORD 294
-#define PERFORM 295
-#define PIDFILE 296
-#define PORT 297
-#define PROTOCOL 298
-#define READTIMEOUT 299
-#define REALNAME 300
-#define RECONNECTINTERVAL 301
-#define REPLY 302
-#define SCANLOG 303
-#define SCANNER 304
-#define SECONDS 305
-#define MINUTES 306
-#define HOURS 307
-#define DAYS 308
-#define WEEKS 309
-#define MONTHS 310
-#define YEARS 311
-#define SENDMAIL 312
-#define SERVER 313
-#define TARGET_IP 314
-#define TARGET_PORT 315
-#define TARGET_STRING 316
-#define TIMEOUT 317
-#define TYPE 318
-#define USERNAME 319
-#define USER 320
-#define VHOST 321
-#define NUMBER 322
-#define STRING 323
-#define PROTOCOLTYPE 324
+#define CACHE_TTL 265
+#define CHANNEL 266
+#define COMMAND_INTERVAL 267
+#define COMMAND_QUEUE_SIZE 268
+#define COMMAND_TIMEOUT 269
+#define CONNECT_RATE 270
+#define CONNREGEX 271
+#define DNS_FDLIMIT 272
+#define DNS_TIMEOUT 273
+#define DNS_UDP_SIZE 274
+#define DNSBL_FROM 275
+#define DNSBL_TO 276
+#define EXEMPT 277
+#define FD 278
+#define HASH 279
+#define INVITE 280
+#define IPV4 281
+#define IPV6 282
+#define IRC 283
+#define KLINE 284
+#define KEY 285
+#define MASK 286
+#define MAX_READ 287
+#define MODE 288
+#define NAME 289
+#define NEGCACHE 290
+#define NEGCACHE_BACKEND 291
+#define NEGCACHE_FILE 292
+#define NEGCACHE_IPV4_PREFIX 293
+#define NEGCACHE_IPV6_PREFIX 294
+#define NEGCACHE_REBUILD 295
+#define NEGCACHE_SNAPSHOT 296
+#define NICK 297
+#define NICKSERV 298
+#define NOTICE 299
+#define OPER 300
+#define OPM 301
+#define OPTIONS 302
+#define PASSWORD 303
+#define PERFORM 304
+#define PIDFILE 305
+#define PORT 306
+#define PROTOCOL 307
+#define READTIMEOUT 308
+#define REALNAME 309
+#define RECONNECTINTERVAL 310
+#define REPLY 311
+#define SCANLOG 312
+#define SCANNER 313
+#define SECONDS 314
+#define MINUTES 315
+#define HOURS 316
+#define DAYS 317
+#define WEEKS 318
+#define MONTHS 319
+#define YEARS 320
+#define SENDMAIL 321
+#define SERVER 322
+#define TARGET_IP 323
+#define TARGET_PORT 324
+#define TARGET_STRING 325
+#define TIMEOUT 326
+#define TRIE 327
+#define TXT_REASON 328
+#define TYPE 329
+#define USERNAME 330
+#define USER 331
+#define VHOST 332
+#define ZONE_FILE 333
+#define NUMBER 334
+#define STRING 335
+#define PROTOCOLTYPE 336
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 91 "config-parser.y" /* yacc.c:1909  */
+#line 103 "config-parser.y"
 
   int number;
   char *string;
 
-#line 197 "config-parser.h" /* yacc.c:1909  */
-};
+#line 234 "config-parser.h"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -204,6 +241,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_CONFIG_PARSER_H_INCLUDED  */
@@ -35,17 +35,21 @@ static void *tmp;  /* Variable to temporarily hold nodes before insertion to lis
 %token BAN_UNKNOWN
 %token BLACKLIST
 %token BYTES KBYTES MBYTES
+%token CACHE_TTL
 %token CHANNEL
 %token COMMAND_INTERVAL
 %token COMMAND_QUEUE_SIZE
 %token COMMAND_TIMEOUT
+%token CONNECT_RATE
 %token CONNREGEX
 %token DNS_FDLIMIT
 %token DNS_TIMEOUT
+%token DNS_UDP_SIZE
 %token DNSBL_FROM
 %token DNSBL_TO
 %token EXEMPT
 %token FD
+%token HASH
 %token INVITE
 %token IPV4
 %token IPV6
@@ -57,7 +61,12 @@ static void *tmp;  /* Variable to temporarily hold nodes before insertion to lis
 %token MODE
 %token NAME
 %token NEGCACHE
+%token NEGCACHE_BACKEND
+%token NEGCACHE_FILE
+%token NEGCACHE_IPV4_PREFIX
+%token NEGCACHE_IPV6_PREFIX
 %token NEGCACHE_REBUILD
+%token NEGCACHE_SNAPSHOT
 %token NICK
 %token NICKSERV
 %token NOTICE
@@ -82,10 +91,13 @@ static void *tmp;  /* Variable to temporarily hold nodes before insertion to lis
 %token TARGET_PORT
 %token TARGET_STRING
 %token TIMEOUT
+%token TRIE
+%token TXT_REASON
 %token TYPE
 %token USERNAME
 %token USER
 %token VHOST
+%token ZONE_FILE
 
 %union
 {
@@ -141,9 +153,15 @@ options_items: options_items options_item |
 
 options_item: options_negcache           |
               options_negcache_rebuild   |
+              options_negcache_file      |
+              options_negcache_snapshot  |
+              options_negcache_backend   |
+              options_negcache_ipv4_prefix |
+              options_negcache_ipv6_prefix |
               options_pidfile            |
               options_dns_fdlimit        |
               options_dns_timeout        |
+              options_dns_udp_size       |
               options_scanlog            |
               options_command_queue_size |
               options_command_interval   |
@@ -160,6 +178,35 @@ options_negcache_rebuild: NEGCACHE_REBUILD '=' timespec ';'
   OptionsItem->negcache_rebuild = $3;
 };
 
+options_negcache_file: NEGCACHE_FILE '=' STRING ';'
+{
+  xfree(OptionsItem->negcache_file);
+  OptionsItem->negcache_file = xstrdup($3);
+};
+
+options_negcache_snapshot: NEGCACHE_SNAPSHOT '=' timespec ';'
+{
+  OptionsItem->negcache_snapshot = $3;
+};
+
+options_negcache_backend: NEGCACHE_BACKEND '=' TRIE ';'
+{
+  OptionsItem->negcache_backend = NEGCACHE_BACKEND_TRIE;
+} | NEGCACHE_BACKEND '=' HASH ';'
+{
+  OptionsItem->negcache_backend = NEGCACHE_BACKEND_HASH;
+};
+
+options_negcache_ipv4_prefix: NEGCACHE_IPV4_PREFIX '=' NUMBER ';'
+{
+  OptionsItem->negcache_ipv4_prefix = $3;
+};
+
+options_negcache_ipv6_prefix: NEGCACHE_IPV6_PREFIX '=' NUMBER ';'
+{
+  OptionsItem->negcache_ipv6_prefix = $3;
+};
+
 options_pidfile: PIDFILE '=' STRING ';'
 {
   xfree(OptionsItem->pidfile);
@@ -176,6 +223,11 @@ options_dns_timeout: DNS_TIMEOUT '=' timespec ';'
   OptionsItem->dns_timeout = $3;
 };
 
+options_dns_udp_size: DNS_UDP_SIZE '=' NUMBER ';'
+{
+  OptionsItem->dns_udp_size = $3;
+};
+
 options_scanlog: SCANLOG '=' STRING ';'
 {
   xfree(OptionsItem->scanlog);
@@ -444,6 +496,7 @@ scanner_entry:
     item->target_port = olditem->target_port;
     item->timeout = olditem->timeout;
     item->max_read = olditem->max_read;
+    item->connect_rate = olditem->connect_rate;
     item->target_string = olditem->target_string;
     item->target_string_created = 0;
   }
@@ -455,6 +508,7 @@ scanner_entry:
     item->target_port = 6667;
     item->timeout = 30;
     item->max_read = 4096;
+    item->connect_rate = 0;
     item->target_string = list_create();
     item->target_string_created = 1;
   }
@@ -480,6 +534,7 @@ scanner_item: scanner_name          |
               scanner_protocol      |
               scanner_timeout       |
               scanner_max_read      |
+              scanner_connect_rate  |
               error;
 
 scanner_name: NAME '=' STRING ';'
@@ -550,6 +605,13 @@ scanner_max_read: MAX_READ '=' sizespec ';'
   item->max_read = $3;
 };
 
+scanner_connect_rate: CONNECT_RATE '=' NUMBER ';'
+{
+  struct ScannerConf *item = tmp;
+
+  item->connect_rate = $3;
+};
+
 scanner_protocol: PROTOCOL '=' PROTOCOLTYPE ':' NUMBER ';'
 {
   struct ProtocolConf *item;
@@ -609,6 +671,7 @@ opm_blacklist_entry:
   item->kline = xstrdup("");
   item->ipv4 = 1;
   item->ban_unknown = 0;
+  item->cache_ttl = 300;
   item->type = A_BITMASK;
   item->reply = list_create();
 
@@ -627,6 +690,9 @@ blacklist_item: blacklist_name           |
                 blacklist_type           |
                 blacklist_kline          |
                 blacklist_ban_unknown    |
+                blacklist_txt_reason     |
+                blacklist_cache_ttl      |
+                blacklist_zone_file      |
                 blacklist_reply          |
                 error;
 
@@ -686,6 +752,28 @@ blacklist_ban_unknown: BAN_UNKNOWN '=' NUMBER ';'
   item->ban_unknown = $3;
 };
 
+blacklist_txt_reason: TXT_REASON '=' NUMBER ';'
+{
+  struct BlacklistConf *item = tmp;
+
+  item->txt_reason = $3;
+};
+
+blacklist_cache_ttl: CACHE_TTL '=' timespec ';'
+{
+  struct BlacklistConf *item = tmp;
+
+  item->cache_ttl = $3;
+};
+
+blacklist_zone_file: ZONE_FILE '=' STRING ';'
+{
+  struct BlacklistConf *item = tmp;
+
+  xfree(item->zone_file);
+  item->zone_file = xstrdup($3);
+};
+
 blacklist_reply: REPLY '{' blacklist_reply_items '}' ';';
 
 blacklist_reply_items: blacklist_reply_items blacklist_reply_item |
@@ -35,6 +35,7 @@
 #include "opercmd.h"
 #include "stats.h"
 #include "firedns.h"
+#include "dnsbl.h"
 #include "misc.h"
 
 
@@ -98,9 +99,15 @@ config_setup(void)
   OptionsItem->command_timeout = 180;
   OptionsItem->negcache = 0;   /* 0 disabled negcache */
   OptionsItem->negcache_rebuild = 43200;
+  OptionsItem->negcache_file = NULL;
+  OptionsItem->negcache_snapshot = 600;
+  OptionsItem->negcache_backend = NEGCACHE_BACKEND_TRIE;
+  OptionsItem->negcache_ipv4_prefix = 32;
+  OptionsItem->negcache_ipv6_prefix = 64;
   OptionsItem->pidfile = xstrdup("hopm.pid");
   OptionsItem->dns_fdlimit = 50;
   OptionsItem->dns_timeout = 5;
+  OptionsItem->dns_udp_size = 1232;
   OptionsItem->scanlog = NULL;
 }
 
@@ -127,6 +134,7 @@ config_load(const char *filename)
   scan_init();     /* Initialize the scanners once we have the configuration */
   stats_init();    /* Initialize stats (UPTIME) */
   firedns_init();  /* Initialize adns */
+  dnsbl_zone_reload(1);  /* Load blacklist zone files */
 }
 
 void
@@ -60,15 +60,27 @@ struct ChannelConf
   char *invite;
 };
 
+enum
+{
+  NEGCACHE_BACKEND_TRIE,
+  NEGCACHE_BACKEND_HASH
+};
+
 struct OptionsConf
 {
   unsigned int command_queue_size;
   time_t command_interval;
   time_t command_timeout;
   time_t negcache;
-  time_t negcache_rebuild;
+  time_t negcache_rebuild;  /* Unused, still accepted in old configuration files */
+  char *negcache_file;
+  time_t negcache_snapshot;
+  int negcache_backend;
+  unsigned int negcache_ipv4_prefix;
+  unsigned int negcache_ipv6_prefix;
   unsigned int dns_fdlimit;
   time_t dns_timeout;
+  unsigned int dns_udp_size;
   char *pidfile;
   char *scanlog;
 };
@@ -89,6 +101,7 @@ struct ScannerConf
   int target_port;
   int timeout;
   int max_read;
+  int connect_rate;
   list_t *target_string;
   int target_string_created;
 };
@@ -121,8 +134,19 @@ struct BlacklistConf
   unsigned int ipv4;
   unsigned int ipv6;
   int ban_unknown;
+  int txt_reason;  /* Also look up the TXT record, for the reason of a listing */
   list_t *reply;
+  time_t cache_ttl;  /* Longest time an answer is cached; 0 disables the cache */
+  struct _patricia_tree_t *cache;
+  list_t cache_list;  /* Cached answers, oldest at the tail */
+  char *zone_file;  /* ip4set/ip6set dataset answering this zone locally, or NULL */
+  struct _patricia_tree_t *zone4;  /* Listed IPv4 ranges of zone_file, once loaded */
+  struct _patricia_tree_t *zone6;
+  time_t zone_mtime;  /* Of zone_file when it was loaded */
+  size_t zone_size;
   unsigned int stats_recv;
+  unsigned int stats_cache_hit;
+  unsigned int stats_cache_miss;
 };
 
 struct BlacklistReplyConf
@@ -23,11 +23,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <time.h>
+#include <errno.h>
 #include <assert.h>
 
 #include "compat.h"
@@ -38,49 +45,570 @@
 #include "main.h"
 #include "match.h"
 #include "memory.h"
+#include "patricia.h"
 #include "scan.h"
 #include "irc.h"
 #include "stats.h"
 
+/*
+ * An answer from a blacklist zone, kept in the zone's patricia trie
+ * under the address that was looked up.
+ */
+struct dnsbl_cache_item
+{
+  node_t node;  /* In bl->cache_list, newest at the head */
+  patricia_node_t *pnode;
+  time_t added;
+  time_t expires;
+  unsigned int count;  /* A records in reply, 0 for NXDOMAIN */
+  unsigned char *reply;
+  char *reason;  /* Of the TXT lookup, or NULL */
+};
+
+/* Reply of zone file entries that do not give one, as in rbldnsd */
+#define DNSBL_ZONE_DEFAULT "127.0.0.2"
+
+static void dnsbl_answer(struct dnsbl_scan *, const char *, const unsigned char *, unsigned int);
+
+
+static void
+dnsbl_cache_remove(struct BlacklistConf *bl, struct dnsbl_cache_item *item)
+{
+  list_remove(&bl->cache_list, &item->node);
+  patricia_remove(bl->cache, item->pnode);
+  xfree(item->reply);
+  xfree(item->reason);
+  xfree(item);
+}
+
+/*
+ * Look up a cached answer of bl for addr. Expired answers are dropped.
+ */
+static struct dnsbl_cache_item *
+dnsbl_cache_check(struct BlacklistConf *bl, const OPM_ADDR_T *addr)
+{
+  if (bl->cache_ttl == 0)
+    return NULL;
+
+  if (bl->cache)
+  {
+    patricia_node_t *pnode = patricia_try_search_exact_bytes(bl->cache, addr->family, addr->bytes);
+    if (pnode)
+    {
+      struct dnsbl_cache_item *item = pnode->data;
+
+      if (item->expires > time(NULL))
+      {
+        ++bl->stats_cache_hit;
+        return item;
+      }
+
+      dnsbl_cache_remove(bl, item);
+    }
+  }
+
+  ++bl->stats_cache_miss;
+  return NULL;
+}
+
+/*
+ * Remember the answer in res for as long as its TTL allows, but no
+ * longer than the cache_ttl of the blacklist. Errors and timeouts
+ * are not cached.
+ */
+static void
+dnsbl_cache_store(const struct dnsbl_scan *ds, const struct firedns_result *res)
+{
+  struct BlacklistConf *bl = ds->bl;
+  time_t ttl = bl->cache_ttl;
+
+  if ((time_t)res->ttl < ttl)
+    ttl = res->ttl;
+
+  if (ttl == 0)
+    return;
+
+  if (firedns_errno != FDNS_ERR_NONE && firedns_errno != FDNS_ERR_NXDOMAIN)
+    return;
+
+  if (bl->cache == NULL)
+    bl->cache = patricia_new(PATRICIA_MAXBITS);
+
+  patricia_node_t *pnode = patricia_make_and_lookup_bytes(bl->cache, ds->ss->addr.family, ds->ss->addr.bytes);
+  if (pnode == NULL)
+    return;
+
+  struct dnsbl_cache_item *item = pnode->data;
+  if (item)
+  {
+    list_remove(&bl->cache_list, &item->node);  /* Refreshed, moves to the head */
+    xfree(item->reply);
+    xfree(item->reason);
+  }
+  else
+  {
+    item = xcalloc(sizeof(*item));
+    item->pnode = pnode;
+    item->node.data = item;
+    pnode->data = item;
+  }
+
+  item->added = time(NULL);
+  item->expires = item->added + ttl;
+  item->count = firedns_errno == FDNS_ERR_NONE ? res->count : 0;
+  item->reply = NULL;
+  item->reason = ds->reason ? xstrdup(ds->reason) : NULL;
+
+  if (item->count)
+  {
+    item->reply = xcalloc(item->count * 4);
+    memcpy(item->reply, res->text, item->count * 4);
+  }
+
+  list_add(&bl->cache_list, &item->node);
+}
+
+/*
+ * Drop cached answers that have expired, and reload zone files that
+ * changed. Entries are ordered by the time they were added and none
+ * outlives cache_ttl, so only the tail of each list needs to be looked
+ * at.
+ */
+void
+dnsbl_timer(void)
+{
+  const time_t now = time(NULL);
+  node_t *node;
+
+  dnsbl_zone_reload(0);
+
+  LIST_FOREACH(node, OpmItem->blacklists->head)
+  {
+    struct BlacklistConf *bl = node->data;
+
+    while (bl->cache_list.tail)
+    {
+      struct dnsbl_cache_item *item = bl->cache_list.tail->data;
+
+      if (item->added + bl->cache_ttl > now)
+        break;
+
+      dnsbl_cache_remove(bl, item);
+    }
+  }
+}
+
+/*
+ * Parse the reply of a zone file entry, either an address or just the
+ * number that makes the last octet of 127.0.0.x. Returns it as stored
+ * in the trie, in network byte order, or 0 if it is not valid.
+ */
+static uint32_t
+dnsbl_zone_value(const char *str)
+{
+  struct in_addr addr;
+  char *end;
+  unsigned long n;
+
+  if (inet_pton(AF_INET, str, &addr) == 1)
+    return addr.s_addr;
+
+  n = strtoul(str, &end, 10);
+  if (*end || n == 0 || n > 255)
+    return 0;
+
+  return htonl(0x7f000000 | n);
+}
+
+/*
+ * Parse the IPv4 entry str: an address, a prefix such as 10.0.0.0/8, a
+ * leading part of an address standing for the whole range (10.1 is
+ * 10.1.0.0/16), or a range from an address to another address or to a
+ * last octet (10.0.0.5-10.0.0.9, 10.0.0.5-9). Returns -1 if it is none
+ * of these.
+ */
+static int
+dnsbl_zone_ip4(const char *str, uint32_t *first, uint32_t *last)
+{
+  uint32_t addr = 0;
+  unsigned int octets = 0, bits;
+  const char *p = str;
+  char *end;
+
+  while (octets < 4 && isdigit((unsigned char)*p))
+  {
+    const unsigned long n = strtoul(p, &end, 10);
+
+    if (n > 255)
+      return -1;
+
+    addr |= n << (24 - 8 * octets++);
+    p = end;
+
+    if (*p != '.')
+      break;
+    ++p;
+  }
+
+  if (octets == 0)
+    return -1;
+
+  bits = 8 * octets;
+
+  if (*p == '/')
+  {
+    bits = strtoul(p + 1, &end, 10);
+    if (end == p + 1 || *end || bits > 32)
+      return -1;
+  }
+  else if (*p == '-' && octets == 4)
+  {
+    struct in_addr to;
+    unsigned long n;
+
+    if (inet_pton(AF_INET, p + 1, &to) == 1)
+      *last = ntohl(to.s_addr);
+    else if ((n = strtoul(p + 1, &end, 10)) <= 255 && end != p + 1 && *end == '\0')
+      *last = (addr & 0xffffff00) | n;
+    else
+      return -1;
+
+    *first = addr;
+    return *first <= *last ? 0 : -1;
+  }
+  else if (*p)
+    return -1;
+
+  const uint32_t mask = bits ? 0xffffffff << (32 - bits) : 0;
+
+  *first = addr & mask;
+  *last = *first | ~mask;
+  return 0;
+}
+
+/*
+ * Add the IPv4 range first to last to tree as the fewest prefixes that
+ * cover it, each with data.
+ */
+static void
+dnsbl_zone_add4(struct _patricia_tree_t *tree, uint32_t first, uint32_t last, void *data)
+{
+  uint64_t start = first;
+
+  while (start <= last)
+  {
+    uint64_t size = start ? start & -start : (uint64_t)1 << 32;
+    unsigned int bits = 32;
+
+    while (start + size - 1 > last)
+      size >>= 1;
+    for (uint64_t n = size; n > 1; n >>= 1)
+      --bits;
+
+    const uint32_t net = htonl((uint32_t)start);
+    patricia_node_t *pnode = patricia_make_and_lookup_bits(tree, AF_INET, &net, bits);
+
+    if (pnode)
+      pnode->data = data;
+
+    start += size;
+  }
+}
+
+/*
+ * Add one line of an rbldnsd ip4set or ip6set dataset to the tries:
+ * an entry, optionally followed by ':' and its reply, and for IPv4 an
+ * optional text after another ':', which is ignored. An entry starting
+ * with '!' is excluded from wider ranges listed. A line of only
+ * ':reply' changes the reply of the entries after it that give none.
+ * Comments and $ directives are skipped. Returns 1 for an entry, 0 for
+ * anything else understood, -1 if the line is not understood.
+ */
+static int
+dnsbl_zone_line(struct _patricia_tree_t *zone4, struct _patricia_tree_t *zone6,
+                char *line, uint32_t *def)
+{
+  char *entry, *value = NULL;  /* What follows the ':' of the reply */
+  uint32_t reply = *def;
+  int excluded = 0;
+
+  while (isspace((unsigned char)*line))
+    ++line;
+
+  if (*line == '\0' || *line == '#' || *line == ';' || *line == '$')
+    return 0;
+
+  if (*line == ':')
+  {
+    line[strcspn(line + 1, ": \t") + 1] = '\0';
+
+    if ((reply = dnsbl_zone_value(line + 1)) == 0)
+      return -1;
+
+    *def = reply;
+    return 0;
+  }
+
+  if (*line == '!')
+  {
+    excluded = 1;
+    ++line;
+  }
+
+  entry = line;
+  line += strcspn(line, " \t");
+
+  if (*line)
+  {
+    *line++ = '\0';
+    line += strspn(line, " \t");
+
+    if (*line == ':')
+      value = line + 1;
+  }
+
+  /*
+   * An IPv6 entry has colons but no dot before the first one. An IPv4
+   * entry may be followed by its reply without blanks.
+   */
+  char *const colon = strchr(entry, ':');
+  const int ipv6 = colon && memchr(entry, '.', colon - entry) == NULL && strchr(colon + 1, ':');
+
+  if (colon && !ipv6)
+  {
+    *colon = '\0';
+    value = colon + 1;
+  }
+
+  if (value)
+  {
+    value[strcspn(value, ": \t")] = '\0';
+
+    if (*value && (reply = dnsbl_zone_value(value)) == 0)
+      return -1;
+  }
+
+  void *const data = excluded ? NULL : (void *)(uintptr_t)reply;
+
+  if (ipv6)
+  {
+    struct in6_addr addr;
+    unsigned int bits = 128;
+    char *slash = strchr(entry, '/');
+
+    if (slash)
+    {
+      char *end;
+
+      *slash = '\0';
+      bits = strtoul(slash + 1, &end, 10);
+
+      if (end == slash + 1 || *end || bits > 128)
+        return -1;
+    }
+
+    if (inet_pton(AF_INET6, entry, &addr) != 1)
+      return -1;
+
+    for (unsigned int i = bits; i < 128; ++i)
+      addr.s6_addr[i / 8] &= ~(0x80 >> (i % 8));
+
+    patricia_node_t *pnode = patricia_make_and_lookup_bits(zone6, AF_INET6, &addr, bits);
+    if (pnode)
+      pnode->data = data;
+  }
+  else
+  {
+    uint32_t first, last;
+
+    if (dnsbl_zone_ip4(entry, &first, &last) == -1)
+      return -1;
+
+    dnsbl_zone_add4(zone4, first, last, data);
+  }
+
+  return 1;
+}
 
 /*
- * Work out the DNSBL zones and send the dns query
+ * Load the zone file of bl through mmap into new tries, which only
+ * replace the old ones once the whole file is read, so the zone keeps
+ * answering from the old data if the file cannot be read. Unless force
+ * is set, the file is only read if its time or size changed.
+ */
+static void
+dnsbl_zone_load(struct BlacklistConf *bl, int force)
+{
+  struct stat st;
+  unsigned int entries = 0, bad = 0;
+  uint32_t def = 0;
+  char *map = NULL;
+  int fd;
+
+  if (stat(bl->zone_file, &st) == -1)
+  {
+    if (force)
+      log_printf("DNSBL -> Cannot read zone file %s of %s: %s", bl->zone_file,
+                 bl->name, strerror(errno));
+    return;
+  }
+
+  if (!force && bl->zone4 && st.st_mtime == bl->zone_mtime && (size_t)st.st_size == bl->zone_size)
+    return;
+
+  if ((fd = open(bl->zone_file, O_RDONLY)) == -1 || fstat(fd, &st) == -1 ||
+      (st.st_size && (map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED))
+  {
+    log_printf("DNSBL -> Cannot read zone file %s of %s: %s", bl->zone_file,
+               bl->name, strerror(errno));
+
+    if (fd != -1)
+      close(fd);
+    return;
+  }
+
+  struct _patricia_tree_t *const zone4 = patricia_new(32);
+  struct _patricia_tree_t *const zone6 = patricia_new(128);
+  const char *const end = map + st.st_size;
+
+  def = dnsbl_zone_value(DNSBL_ZONE_DEFAULT);
+
+  for (const char *p = map; p < end; )
+  {
+    const char *eol = memchr(p, '\n', end - p);
+    const size_t len = (eol ? eol : end) - p;
+    char line[256];
+
+    if (len < sizeof(line))
+    {
+      memcpy(line, p, len);
+      line[len] = '\0';
+      line[strcspn(line, "\r")] = '\0';
+
+      switch (dnsbl_zone_line(zone4, zone6, line, &def))
+      {
+        case 1:
+          ++entries;
+          break;
+        case -1:
+          ++bad;
+          break;
+      }
+    }
+    else
+      ++bad;
+
+    p = eol ? eol + 1 : end;
+  }
+
+  if (map)
+    munmap(map, st.st_size);
+  close(fd);
+
+  if (bl->zone4)
+    patricia_destroy(bl->zone4, NULL);
+  if (bl->zone6)
+    patricia_destroy(bl->zone6, NULL);
+
+  bl->zone4 = zone4;
+  bl->zone6 = zone6;
+  bl->zone_mtime = st.st_mtime;
+  bl->zone_size = st.st_size;
+
+  log_printf("DNSBL -> Loaded %u entries of %s from %s", entries, bl->name, bl->zone_file);
+
+  if (bad)
+    log_printf("DNSBL -> Skipped %u lines of %s that are not understood", bad, bl->zone_file);
+}
+
+/*
+ * Reload the zone files of blacklists answered locally; only those
+ * changed since they were loaded unless force is set.
  */
 void
+dnsbl_zone_reload(int force)
+{
+  node_t *node;
+
+  LIST_FOREACH(node, OpmItem->blacklists->head)
+  {
+    struct BlacklistConf *bl = node->data;
+
+    if (bl->zone_file)
+      dnsbl_zone_load(bl, force);
+  }
+}
+
+/*
+ * Look addr up in the zone file of bl. Returns 1 and the reply in reply
+ * if it is listed, 0 if it is not, -1 if the file never loaded.
+ */
+static int
+dnsbl_zone_check(const struct BlacklistConf *bl, const OPM_ADDR_T *addr, unsigned char *reply)
+{
+  struct _patricia_tree_t *const tree = addr->family == AF_INET6 ? bl->zone6 : bl->zone4;
+
+  if (tree == NULL)
+    return -1;
+
+  const patricia_node_t *pnode = patricia_try_search_best_bytes(tree, addr->family, addr->bytes);
+
+  if (pnode == NULL || pnode->data == NULL)
+    return 0;
+
+  const uint32_t value = (uintptr_t)pnode->data;
+  memcpy(reply, &value, sizeof(value));
+  return 1;
+}
+
+/*
+ * Hand an answer known without asking the resolver to dnsbl_answer():
+ * count A records in reply, none if the address is not listed.
+ */
+static void
+dnsbl_answer_now(struct dnsbl_scan *ds, const char *lookup, const unsigned char *reply,
+                 unsigned int count, const char *reason)
+{
+  if (reason)
+    ds->reason = xstrdup(reason);
+
+  firedns_errno = count ? FDNS_ERR_NONE : FDNS_ERR_NXDOMAIN;
+  ++ds->ss->scans;
+  dnsbl_answer(ds, lookup, reply, count);
+}
+
+/*
+ * Work out the DNSBL zones and send the dns query. Cached answers and
+ * zones answered from a zone file are handled right away, so the caller
+ * must hold a reference in ss->scans.
+ * Returns the number of zones that were checked.
+ */
+unsigned int
 dnsbl_add(struct scan_struct *ss)
 {
   char lookup[128];
   node_t *node;
-  struct addrinfo hints, *addr_res;
-
-  memset(&hints, 0, sizeof(hints));
-  hints.ai_family = PF_UNSPEC;
-  hints.ai_flags = AI_NUMERICHOST;
+  const uint8_t *b = ss->addr.bytes;
+  unsigned int checked = 0;
 
-  if (getaddrinfo(ss->ip, NULL, &hints, &addr_res))
+  if (ss->addr.family == 0)
   {
     log_printf("DNSBL -> Invalid address '%s', ignoring.", ss->ip);
-    return;
+    return 0;
   }
 
   LIST_FOREACH(node, OpmItem->blacklists->head)
   {
     struct BlacklistConf *bl = node->data;
 
-    if (addr_res->ai_family == AF_INET && bl->ipv4)
+    if (ss->addr.family == AF_INET && bl->ipv4)
     {
-      const struct sockaddr_in *v4 = (const struct sockaddr_in *)addr_res->ai_addr;
-      const uint8_t *b = (const uint8_t *)&v4->sin_addr.s_addr;
-
       snprintf(lookup, sizeof(lookup), "%u.%u.%u.%u.%s",
                (unsigned int)(b[3]), (unsigned int)(b[2]),
                (unsigned int)(b[1]), (unsigned int)(b[0]), bl->name);
     }
-    else if (addr_res->ai_family == AF_INET6 && bl->ipv6)
+    else if (ss->addr.family == AF_INET6 && bl->ipv6)
     {
-      const struct sockaddr_in6 *v6 = (const struct sockaddr_in6 *)addr_res->ai_addr;
-      const uint8_t *b = (const uint8_t *)&v6->sin6_addr.s6_addr;
-
       snprintf(lookup, sizeof(lookup),
                "%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x."
                "%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%x.%s",
@@ -104,149 +632,226 @@ dnsbl_add(struct scan_struct *ss)
     else
       continue;
 
+    if (bl->zone_file)
+    {
+      unsigned char reply[4];
+      const int listed = dnsbl_zone_check(bl, &ss->addr, reply);
+
+      if (listed == -1)
+        continue;
+
+      struct dnsbl_scan *ds = xcalloc(sizeof *ds);
+      ds->ss = ss;
+      ds->bl = bl;
+
+      if (OPT_DEBUG)
+        log_printf("DNSBL -> Looked up '%s' in %s", lookup, bl->zone_file);
+
+      ++checked;
+      dnsbl_answer_now(ds, lookup, reply, listed, NULL);
+      continue;
+    }
+
     struct dnsbl_scan *ds = xcalloc(sizeof *ds);
     ds->ss = ss;
     ds->bl = bl;
 
+    const struct dnsbl_cache_item *item = dnsbl_cache_check(bl, &ss->addr);
+    if (item)
+    {
+      if (OPT_DEBUG)
+        log_printf("DNSBL -> Using cached answer for '%s'", lookup);
+
+      ++checked;
+      dnsbl_answer_now(ds, lookup, item->reply, item->count, item->reason);
+      continue;
+    }
+
     if (OPT_DEBUG)
       log_printf("DNSBL -> Passed '%s' to resolver", lookup);
 
-    int res = firedns_getip(FDNS_QRY_A, lookup, ds);
+    ds->pending = 1;
+
+    int res = firedns_getip(FDNS_QRY_A, lookup, dnsbl_result, ds);
     if (res == -1 && firedns_errno != FDNS_ERR_FDLIMIT)
     {
       log_printf("DNSBL -> Error sending dns lookup for '%s': %s", lookup, firedns_strerror(firedns_errno));
       xfree(ds);
+      continue;
+    }
+
+    ++ss->scans;  /* Increase scan count - one for each blacklist */
+    ++checked;
+
+    /* The reason goes out along with the A lookup, not after it */
+    if (bl->txt_reason)
+    {
+      ++ds->pending;
+
+      res = firedns_getip(FDNS_QRY_TXT, lookup, dnsbl_result, ds);
+      if (res == -1 && firedns_errno != FDNS_ERR_FDLIMIT)
+        --ds->pending;
     }
-    else
-      ++ss->scans;  /* Increase scan count - one for each blacklist */
   }
 
-  freeaddrinfo(addr_res);
+  return checked;
 }
 
+/*
+ * Report ss as listed in bl, for every reply in the count A records in
+ * reply, with the reason of the TXT record if there is one.
+ */
 static void
-dnsbl_positive(struct scan_struct *ss, struct BlacklistConf *bl, unsigned char type)
+dnsbl_positive(struct scan_struct *ss, struct BlacklistConf *bl, const unsigned char *reply,
+               unsigned int count, const char *reason)
 {
   char text_type[128] = "";
+  unsigned char bits = 0;
   node_t *node;
 
-  if (bl->type == A_BITMASK)
+  for (unsigned int i = 0; i < count; ++i)
+    bits |= reply[i * 4 + 3];
+
+  LIST_FOREACH(node, bl->reply->head)
   {
-    LIST_FOREACH(node, bl->reply->head)
-    {
-      const struct BlacklistReplyConf *item = node->data;
+    const struct BlacklistReplyConf *item = node->data;
+    int match = 0;
 
-      if (item->number & type)
-      {
-        strlcat(text_type, item->type, sizeof(text_type));
-        strlcat(text_type, ", ", sizeof(text_type));
-      }
-    }
+    if (bl->type == A_BITMASK)
+      match = (item->number & bits) != 0;
+    else
+      for (unsigned int i = 0; i < count && !match; ++i)
+        match = item->number == reply[i * 4 + 3];
 
-    if (text_type[0])
-      *(strrchr(text_type, ',')) = '\0';
-  }
-  else
-  {
-    LIST_FOREACH(node, bl->reply->head)
+    if (match)
     {
-      const struct BlacklistReplyConf *item = node->data;
-
-      if (item->number == type)
-      {
-        strlcpy(text_type, item->type, sizeof(text_type));
-        break;
-      }
+      strlcat(text_type, item->type, sizeof(text_type));
+      strlcat(text_type, ", ", sizeof(text_type));
     }
   }
 
+  if (text_type[0])
+    *(strrchr(text_type, ',')) = '\0';
+
   if (text_type[0] == '\0' && bl->ban_unknown == 0)
   {
     if (OPT_DEBUG)
-      log_printf("DNSBL -> Unknown result from BL zone %s (%d)", bl->name, type);
+      log_printf("DNSBL -> Unknown result from BL zone %s (%d)", bl->name, reply[3]);
 
     return;
   }
 
   if (ss->manual_target)
-    irc_send("PRIVMSG %s :CHECK -> DNSBL -> %s appears in BL zone %s (%s)",
-             ss->manual_target, ss->ip, bl->name, text_type);
+    irc_send("PRIVMSG %s :CHECK -> DNSBL -> %s appears in BL zone %s (%s)%s%s",
+             ss->manual_target, ss->ip, bl->name, text_type,
+             reason ? ": " : "", reason ? reason : "");
   else if (ss->positive == 0)
   {
     /* Only report it if no other scans have found positives yet. */
     scan_positive(ss, (EmptyString(bl->kline) ? IRCItem->kline : bl->kline), text_type);
 
-    irc_send_channels("DNSBL -> %s!%s@%s [%s] appears in BL zone %s (%s)",
+    irc_send_channels("DNSBL -> %s!%s@%s [%s] appears in BL zone %s (%s)%s%s",
                       ss->irc_nick, ss->irc_username, ss->irc_hostname, ss->ip, bl->name,
-                      text_type);
-    log_printf("DNSBL -> %s!%s@%s [%s] appears in BL zone %s (%s)",
+                      text_type, reason ? ": " : "", reason ? reason : "");
+    log_printf("DNSBL -> %s!%s@%s [%s] appears in BL zone %s (%s)%s%s",
                ss->irc_nick, ss->irc_username, ss->irc_hostname, ss->ip, bl->name,
-               text_type);
+               text_type, reason ? ": " : "", reason ? reason : "");
   }
 
   /* Record stat */
   stats_dnsblrecv(bl);
 }
 
-void
-dnsbl_result(struct firedns_result *res)
+/*
+ * Act on the answer of bl for ds->ss: count A records in reply if it is
+ * listed, firedns_errno telling if it is. Frees ds.
+ */
+static void
+dnsbl_answer(struct dnsbl_scan *ds, const char *lookup, const unsigned char *reply, unsigned int count)
 {
-  struct dnsbl_scan *const ds = res->info;
+  static const unsigned char none[4];
+  const unsigned char *const first = count ? reply : none;
 
   if (OPT_DEBUG)
   {
     if (ds->ss->manual_target)
-      log_printf("DNSBL -> Lookup result for %s (%s) %d.%d.%d.%d (error: %d)",
+      log_printf("DNSBL -> Lookup result for %s (%s) %d.%d.%d.%d (%u records, error: %d)",
                  ds->ss->ip,
-                 res->lookup,
-                 (unsigned char)res->text[0],
-                 (unsigned char)res->text[1],
-                 (unsigned char)res->text[2],
-                 (unsigned char)res->text[3], firedns_errno);
+                 lookup,
+                 first[0], first[1], first[2], first[3], count, firedns_errno);
     else
-      log_printf("DNSBL -> Lookup result for %s!%s@%s (%s) %d.%d.%d.%d (error: %d)",
+      log_printf("DNSBL -> Lookup result for %s!%s@%s (%s) %d.%d.%d.%d (%u records, error: %d)",
                  ds->ss->irc_nick,
                  ds->ss->irc_username,
                  ds->ss->irc_hostname,
-                 res->lookup,
-                 (unsigned char)res->text[0],
-                 (unsigned char)res->text[1],
-                 (unsigned char)res->text[2],
-                 (unsigned char)res->text[3], firedns_errno);
+                 lookup,
+                 first[0], first[1], first[2], first[3], count, firedns_errno);
   }
 
   /* Everything is OK */
-  if (res->text[0] == '\0' && firedns_errno == FDNS_ERR_NXDOMAIN)
+  if (firedns_errno == FDNS_ERR_NXDOMAIN)
   {
     if (ds->ss->manual_target)
       irc_send("PRIVMSG %s :CHECK -> DNSBL -> %s does not appear in BL zone %s",
                ds->ss->manual_target, ds->ss->ip, ds->bl->name);
-
-    --ds->ss->scans;  /* We are done with ss here */
-    scan_checkfinished(ds->ss);  /* This could free ss, don't use ss after this point */
-    xfree(ds);  /* No longer need our information */
-    return;
   }
-
   /* Either an error, or a positive lookup */
-  if (firedns_errno == FDNS_ERR_NONE)
-    dnsbl_positive(ds->ss, ds->bl, (unsigned char)res->text[3]);
+  else if (firedns_errno == FDNS_ERR_NONE)
+    dnsbl_positive(ds->ss, ds->bl, reply, count, ds->reason);
   else
   {
-    log_printf("DNSBL -> Lookup error on %s: %s", res->lookup,
+    log_printf("DNSBL -> Lookup error on %s: %s", lookup,
                firedns_strerror(firedns_errno));
 
     if (firedns_errno != FDNS_ERR_TIMEOUT)
-      irc_send_channels("DNSBL -> Lookup error on %s: %s", res->lookup,
+      irc_send_channels("DNSBL -> Lookup error on %s: %s", lookup,
                         firedns_strerror(firedns_errno));
   }
 
   /* Check if ss has any remaining scans */
   --ds->ss->scans;  /* We are done with ss here */
   scan_checkfinished(ds->ss);  /* This could free ss, don't use ss after this point */
+  xfree(ds->reason);
   xfree(ds);  /* Finished with dnsbl_scan too */
 }
 
+/*
+ * Callback of the A and TXT lookups of a blacklist. Whichever comes
+ * first is kept until the other one is in too, so the answer is acted
+ * on with its reason.
+ */
+void
+dnsbl_result(struct firedns_result *res)
+{
+  struct dnsbl_scan *const ds = res->info;
+  struct firedns_result *answer = res;
+
+  if (res->type == FDNS_QRY_TXT)
+  {
+    if (firedns_errno == FDNS_ERR_NONE && res->text[0])
+      ds->reason = xstrdup(res->text);
+
+    if (--ds->pending)
+      return;
+
+    answer = ds->answer;
+    firedns_errno = ds->error;
+  }
+  else if (--ds->pending)
+  {
+    ds->answer = xcalloc(sizeof(*ds->answer));
+    memcpy(ds->answer, res, sizeof(*res));
+    ds->error = firedns_errno;
+    return;
+  }
+
+  dnsbl_cache_store(ds, answer);
+  dnsbl_answer(ds, answer->lookup, (const unsigned char *)answer->text, answer->count);
+
+  if (answer != res)
+    xfree(answer);
+}
+
 void
 dnsbl_cycle(void)
 {
@@ -29,10 +29,16 @@ struct dnsbl_scan
 {
   struct scan_struct *ss;
   struct BlacklistConf *bl;
+  unsigned int pending;  /* Lookups not answered yet: the A one, and the TXT one if sent */
+  struct firedns_result *answer;  /* Of the A lookup, kept while the TXT one is pending */
+  int error;  /* firedns_errno of answer */
+  char *reason;  /* Text of the TXT lookup, or NULL */
 };
 
-extern void dnsbl_add(struct scan_struct *);
+extern unsigned int dnsbl_add(struct scan_struct *);
 extern void dnsbl_result(struct firedns_result *);
 extern void dnsbl_cycle(void);
+extern void dnsbl_timer(void);
+extern void dnsbl_zone_reload(int);
 extern void dnsbl_report(const struct scan_struct *);
 #endif
@@ -0,0 +1,266 @@
+/*
+ *  Copyright (c) 2014-2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file event.c
+ * \brief Main loop: descriptor readiness and timers.
+ * \version $Id$
+ *
+ * Every pass of the main loop the IRC client, the resolver and the
+ * scanners register the descriptors they wait on with event_fd().
+ * event_wait() then sleeps in a single poll() until one of them becomes
+ * ready, the earliest timer is due, or a deadline requested through
+ * event_timeout() has passed, whichever comes first.
+ */
+
+#include "setup.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <poll.h>
+
+#include "memory.h"
+#include "event.h"
+
+
+struct event_handler
+{
+  EVENT_FD_CB *handler;
+  void *data;
+};
+
+struct event_timer
+{
+  EVENT_TIMER_CB *handler;
+  uint64_t interval;  /* Milliseconds between two runs */
+  uint64_t when;      /* Next run, in event_now() time */
+};
+
+/* Descriptors registered for the current pass, pfds and handlers run in parallel */
+static struct pollfd *event_pfds;
+static struct event_handler *event_handlers;
+static unsigned int event_count, event_size;
+
+/* Binary min-heap of timers ordered by ->when */
+static struct event_timer **event_heap;
+static unsigned int heap_count, heap_size;
+
+/* Earliest deadline requested through event_timeout() for this pass, 0 if none */
+static uint64_t event_deadline;
+
+
+/* event_now
+ *
+ *    Return a monotonic timestamp in milliseconds.
+ */
+uint64_t
+event_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* event_fd
+ *
+ *    Wait for events on fd during the next event_wait(). Registrations
+ *    only last for one pass of the main loop.
+ *
+ * Parameters:
+ *    fd: File descriptor to watch
+ *    events: poll() events of interest
+ *    handler: Called with fd, revents and data once fd is ready
+ *    data: Passed back to handler
+ */
+void
+event_fd(int fd, short events, EVENT_FD_CB *handler, void *data)
+{
+  if (event_count == event_size)
+  {
+    unsigned int size = event_size ? event_size * 2 : 64;
+    struct pollfd *pfds = xcalloc(sizeof(*pfds) * size);
+    struct event_handler *handlers = xcalloc(sizeof(*handlers) * size);
+
+    if (event_count)
+    {
+      memcpy(pfds, event_pfds, sizeof(*pfds) * event_count);
+      memcpy(handlers, event_handlers, sizeof(*handlers) * event_count);
+    }
+
+    xfree(event_pfds);
+    xfree(event_handlers);
+
+    event_pfds = pfds;
+    event_handlers = handlers;
+    event_size = size;
+  }
+
+  event_pfds[event_count].fd = fd;
+  event_pfds[event_count].events = events;
+  event_pfds[event_count].revents = 0;
+  event_handlers[event_count].handler = handler;
+  event_handlers[event_count].data = data;
+  ++event_count;
+}
+
+/* event_timeout
+ *
+ *    Make the next event_wait() return after at most msec milliseconds,
+ *    for work that is not tied to a descriptor.
+ */
+void
+event_timeout(uint64_t msec)
+{
+  uint64_t when = event_now() + msec;
+
+  if (event_deadline == 0 || when < event_deadline)
+    event_deadline = when;
+}
+
+static void
+event_heap_up(unsigned int pos)
+{
+  struct event_timer *timer = event_heap[pos];
+
+  while (pos > 0)
+  {
+    unsigned int parent = (pos - 1) / 2;
+
+    if (event_heap[parent]->when <= timer->when)
+      break;
+
+    event_heap[pos] = event_heap[parent];
+    pos = parent;
+  }
+
+  event_heap[pos] = timer;
+}
+
+static void
+event_heap_down(unsigned int pos)
+{
+  struct event_timer *timer = event_heap[pos];
+
+  while (1)
+  {
+    unsigned int child = pos * 2 + 1;
+
+    if (child >= heap_count)
+      break;
+
+    if (child + 1 < heap_count && event_heap[child + 1]->when < event_heap[child]->when)
+      ++child;
+
+    if (timer->when <= event_heap[child]->when)
+      break;
+
+    event_heap[pos] = event_heap[child];
+    pos = child;
+  }
+
+  event_heap[pos] = timer;
+}
+
+/* event_timer_add
+ *
+ *    Run handler every interval milliseconds, starting one interval
+ *    from now.
+ */
+void
+event_timer_add(EVENT_TIMER_CB *handler, uint64_t interval)
+{
+  struct event_timer *timer = xcalloc(sizeof(*timer));
+
+  timer->handler = handler;
+  timer->interval = interval;
+  timer->when = event_now() + interval;
+
+  if (heap_count == heap_size)
+  {
+    unsigned int size = heap_size ? heap_size * 2 : 8;
+    struct event_timer **heap = xcalloc(sizeof(*heap) * size);
+
+    if (heap_count)
+      memcpy(heap, event_heap, sizeof(*heap) * heap_count);
+
+    xfree(event_heap);
+    event_heap = heap;
+    heap_size = size;
+  }
+
+  event_heap[heap_count] = timer;
+  event_heap_up(heap_count++);
+}
+
+/* event_run_timers
+ *
+ *    Run every timer that is due, then reschedule it. A timer that fell
+ *    behind by more than one interval is not run repeatedly to catch up.
+ */
+static void
+event_run_timers(void)
+{
+  uint64_t now = event_now();
+
+  while (heap_count && event_heap[0]->when <= now)
+  {
+    struct event_timer *timer = event_heap[0];
+
+    timer->handler();
+
+    timer->when += timer->interval;
+    if (timer->when <= now)
+      timer->when = now + timer->interval;
+
+    event_heap_down(0);
+  }
+}
+
+/* event_wait
+ *
+ *    Sleep until a registered descriptor is ready, a timer is due or
+ *    the deadline set with event_timeout() is reached. Then call the
+ *    handlers of ready descriptors and run due timers.
+ */
+void
+event_wait(void)
+{
+  uint64_t now = event_now(), until = event_deadline;
+  int timeout = -1;
+
+  if (heap_count && (until == 0 || event_heap[0]->when < until))
+    until = event_heap[0]->when;
+
+  if (until)
+    timeout = until > now ? until - now : 0;
+
+  if (poll(event_pfds, event_count, timeout) > 0)
+  {
+    for (unsigned int i = 0; i < event_count; ++i)
+      if (event_pfds[i].revents)
+        event_handlers[i].handler(event_pfds[i].fd, event_pfds[i].revents,
+                                  event_handlers[i].data);
+  }
+
+  event_count = 0;
+  event_deadline = 0;
+
+  event_run_timers();
+}
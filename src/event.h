@@ -0,0 +1,38 @@
+/*
+ *  Copyright (c) 2014-2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file event.h
+ * \brief Main loop: descriptor readiness and timers.
+ * \version $Id$
+ */
+
+#ifndef EVENT_H
+#define EVENT_H
+
+#include <stdint.h>
+
+typedef void EVENT_FD_CB(int, short, void *);
+typedef void EVENT_TIMER_CB(void);
+
+extern uint64_t event_now(void);
+extern void event_fd(int, short, EVENT_FD_CB *, void *);
+extern void event_timeout(uint64_t);
+extern void event_timer_add(EVENT_TIMER_CB *, uint64_t);
+extern void event_wait(void);
+#endif /* EVENT_H */
@@ -35,6 +35,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #include <stdio.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <ctype.h>
 
 #include "compat.h"
 #include "memory.h"
@@ -42,28 +43,57 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #include "config.h"
 #include "list.h"
 #include "log.h"
-#include "dnsbl.h"
-
-#define FIREDNS_TRIES 3
+#include "event.h"
+
+/* shared query sockets per address family */
+#define FIREDNS_SOCKETS 4
+/* queries sent from one source port before it is replaced */
+#define FIREDNS_SOCKET_QUERIES 256
+/* buckets of the query ID hash */
+#define FIREDNS_IDHASH 1024
+/* replies read from a socket per event */
+#define FIREDNS_READ_BURST 64
+/* one in this many queries goes to the next server instead of the best one */
+#define FIREDNS_PROBE 64
+/* hedging delay in ms before a server answered anything, and its floor */
+#define FIREDNS_HEDGE_DEFAULT 500
+#define FIREDNS_HEDGE_MIN 10
+/* largest UDP reply we take, and the most dns_udp_size may advertise */
+#define FIREDNS_UDP_MAX 4096
+/* largest reply over TCP, the most its 16 bit length prefix allows */
+#define FIREDNS_TCP_MAX 65535
+/* queries waiting to be written to a TCP connection, in bytes */
+#define FIREDNS_TCP_QUEUE 16384
+/* seconds a TCP connection without queries is kept open for reuse */
+#define FIREDNS_TCP_IDLE 10
+/* size of the EDNS0 OPT record added to queries */
+#define FIREDNS_OPT_SIZE 11
 
 int firedns_errno = FDNS_ERR_NONE;
 
 /* Variables local to this file */
-static unsigned int firedns_fdinuse;
 
-/* up to FDNS_MAX nameservers; populated by firedns_init() */
-static struct in_addr servers4[FDNS_MAX];
-static struct in6_addr servers6[FDNS_MAX];
+/* queries sent and not yet answered or timed out, capped by dns_fdlimit */
+static unsigned int firedns_inflight;
 
-/* actual count of nameservers; set by firedns_init() */
+/* actual count of nameservers per address family; set by firedns_init() */
 static unsigned int i4;
 static unsigned int i6;
 
 /*
- * Linked list of open DNS queries; populated by firedns_add_query(),
- * decimated by firedns_getresult()
+ * Queries sent and waiting for a reply, newest at the head. They all
+ * share dns_timeout, so the tail is always the first to time out.
  */
-static list_t CONNECTIONS;
+static list_t INFLIGHT;
+
+/* Queries held back by dns_fdlimit, oldest at the tail */
+static list_t DEFERRED;
+
+/* Open DNS queries by ID, chained through s_connection.hnext */
+static struct s_connection *idhash[FIREDNS_IDHASH];
+
+/* Open DNS queries by type and name, chained through s_connection.nnext */
+static struct s_connection *namehash[FIREDNS_IDHASH];
 
 /*
  * List of errors, in order of values used in FDNS_ERR_*, returned by
@@ -88,22 +118,88 @@ static const char *const errors[] =
 /* open DNS query */
 struct s_connection
 {
+  node_t node;  /* Links the query into INFLIGHT, or DEFERRED while start is 0 */
+  /*
+   * Links the query into the hedge list of server[0] while hedge_at is
+   * set, or into the queries of tcp while that is set
+   */
+  node_t hedge_node;
+  struct s_connection *hnext;  /* Next query in the same idhash bucket */
+  struct s_connection *nnext;  /* Next query in the same namehash bucket */
+
   /*
    * unique ID (random number), matches header ID; both set by
    * firedns_add_query()
    */
-  unsigned char id[2];
+  uint16_t id;
   uint16_t class;
   uint16_t type;
 
-  /* file descriptor returned from sockets */
-  int fd;
+  /* sockets the query was sent from, -1 if none */
+  int fd4;
+  int fd6;
+  FIREDNS_CB *callback;
   void *info;
-  time_t start;
+  list_t waiters;  /* info of later requests for the same name, oldest at the tail */
+  time_t start;  /* When the query was sent, 0 while deferred by dns_fdlimit */
+  int server[2];  /* Index in servers of the first and the hedge server, -1 if none */
+  uint64_t sent[2];  /* event_now() when the query went to server[0] and server[1] */
+  uint64_t hedge_at;  /* event_now() when to send to a second server, 0 if not to */
+  struct s_tcp *tcp;  /* Connection the query was asked again on after a truncated reply */
   char lookup[256];
-  int v6;
 };
 
+/*
+ * TCP connection to a nameserver, for queries whose reply did not fit
+ * in a datagram. Queries are pipelined and matched to replies by ID.
+ */
+struct s_tcp
+{
+  int fd;
+  int server;  /* Index in servers */
+  int connected;
+  list_t queries;  /* Queries waiting for a reply on this connection */
+  time_t last;  /* When a query was queued or a reply read */
+  size_t outlen;
+  size_t inlen;
+  unsigned char out[FIREDNS_TCP_QUEUE];  /* Length prefixed queries not yet written */
+  unsigned char in[2 + FIREDNS_TCP_MAX];  /* Replies read, up to the one not complete yet */
+};
+
+/* nameserver, and how well it has been answering */
+struct s_server
+{
+  struct sockaddr_storage addr;
+  socklen_t addrlen;
+  unsigned int srtt;  /* Smoothed round trip time in ms */
+  unsigned int rttvar;  /* Smoothed mean deviation of the round trip time in ms */
+  unsigned int loss;  /* Smoothed share of queries not answered, in 1/1000 */
+  unsigned int sent;
+  unsigned int answered;
+  unsigned int lost;
+  unsigned int hedged;  /* Queries sent here after another server was slow */
+  unsigned int tcp;  /* Queries asked again over TCP after a truncated reply */
+  struct s_tcp *conn;  /* Open TCP connection, or NULL */
+  list_t hedge;  /* Queries sent here first and not hedged yet, oldest at the tail */
+};
+
+/* up to FDNS_MAX nameservers per address family; populated by firedns_init() */
+static struct s_server servers[FDNS_MAX * 2];
+static unsigned int nservers;
+
+/* long-lived socket queries of one address family are sent from */
+struct s_socket
+{
+  int fd;
+  unsigned int queries;  /* Queries sent since fd was opened */
+  int old_fd;  /* Replaced socket, open until its queries timed out */
+  time_t retired;
+};
+
+/* pools of shared sockets, opened by firedns_socket() */
+static struct s_socket sockets4[FIREDNS_SOCKETS];
+static struct s_socket sockets6[FIREDNS_SOCKETS];
+
 struct s_rr_middle
 {
   uint16_t type;
@@ -141,31 +237,66 @@ struct s_header
 };
 
 /* Function prototypes */
-static struct s_connection *firedns_add_query(void);
+static struct s_connection *firedns_add_query(int, const char *const, FIREDNS_CB *, void *);
+static struct s_connection *firedns_find(uint16_t);
+static unsigned int firedns_hash_name(int, const char *);
+static struct s_connection *firedns_find_name(int, const char *, FIREDNS_CB *);
+static void firedns_remove(struct s_connection *);
+static void firedns_deliver(struct s_connection *, struct firedns_result *);
+static void firedns_fail(struct s_connection *, int);
 static int firedns_doquery(struct s_connection *);
+static void firedns_server_add(int, const void *);
+static int firedns_server_pick(const struct s_connection *, unsigned int);
+static uint64_t firedns_hedge_delay(const struct s_server *);
+static void firedns_hedge(struct s_connection *);
+static void firedns_answered(const struct s_connection *, int);
+static void firedns_lost(struct s_server *);
+static uint16_t firedns_random(void);
+static int firedns_socket_open(int);
+static int firedns_socket(struct s_socket *, int);
 static int firedns_build_query_payload(const char *const, uint16_t, uint16_t, unsigned char *);
-static int firedns_send_requests(struct s_header *, struct s_connection *, int);
+static int firedns_build_packet(const struct s_connection *, unsigned char *);
+static int firedns_send(struct s_connection *, int);
+static int firedns_recv(int, unsigned char *, size_t, int *);
+static int firedns_parse(const struct s_connection *, const unsigned char *, int, struct firedns_result *);
+static int firedns_skip_name(const unsigned char *, int, int);
+static void firedns_add_record(struct firedns_result *, int, const unsigned char *, unsigned int);
+static unsigned int firedns_soa_ttl(const struct s_header *, const unsigned char *, int, int);
+static int firedns_tcp_query(struct s_connection *, int);
+static void firedns_tcp_close(struct s_tcp *);
 
 
 void
 firedns_init(void)
 {
   /*
-   * populates servers4 (or -6) struct with up to FDNS_MAX nameserver IP
-   * addresses from /etc/firedns.conf (or /etc/resolv.conf)
+   * populates servers with up to FDNS_MAX nameserver IP addresses per
+   * address family from /etc/firedns.conf (or /etc/resolv.conf)
    */
   FILE *f;
   struct in_addr addr4;
   struct in6_addr addr6;
   char buf[1024];
   char *p = NULL;
+  static int sockets_init;
+
+  if (!sockets_init)
+  {
+    for (unsigned int i = 0; i < FIREDNS_SOCKETS; ++i)
+    {
+      sockets4[i].fd = sockets4[i].old_fd = -1;
+      sockets6[i].fd = sockets6[i].old_fd = -1;
+    }
+
+    sockets_init = 1;
+  }
 
   i6 = 0;
   i4 = 0;
+  nservers = 0;
 
   srand((unsigned int)time(NULL));
-  memset(servers4, 0, sizeof(servers4));
-  memset(servers6, 0, sizeof(servers6));
+  memset(servers, 0, sizeof(servers));
 
   /* read etc/firedns.conf if we've got it, otherwise parse /etc/resolv.conf */
   f = fopen(FDNS_CONFIG_PREF, "r");
@@ -196,7 +327,7 @@ firedns_init(void)
         {
           if (inet_pton(AF_INET6, &buf[i], &addr6) > 0)
           {
-            memcpy(&servers6[i6++], &addr6, sizeof(struct in6_addr));
+            firedns_server_add(AF_INET6, &addr6);
             continue;
           }
         }
@@ -204,7 +335,7 @@ firedns_init(void)
         if (i4 < FDNS_MAX)
         {
           if (inet_pton(AF_INET, &buf[i], &addr4) > 0)
-            memcpy(&servers4[i4++], &addr4, sizeof(struct in_addr));
+            firedns_server_add(AF_INET, &addr4);
         }
       }
     }
@@ -220,7 +351,7 @@ firedns_init(void)
       {
         if (inet_pton(AF_INET6, buf, &addr6) > 0)
         {
-          memcpy(&servers6[i6++], &addr6, sizeof(struct in6_addr));
+          firedns_server_add(AF_INET6, &addr6);
           continue;
         }
       }
@@ -228,7 +359,7 @@ firedns_init(void)
       if (i4 < FDNS_MAX)
       {
         if (inet_pton(AF_INET, buf, &addr4) > 0)
-          memcpy(&servers4[i4++], &addr4, sizeof(struct in_addr));
+          firedns_server_add(AF_INET, &addr4);
       }
     }
   }
@@ -236,6 +367,36 @@ firedns_init(void)
   fclose(f);
 }
 
+/* add a nameserver to servers; i4 and i6 count them per address family */
+static void
+firedns_server_add(int family, const void *addr)
+{
+  struct s_server *srv = &servers[nservers++];
+
+  memset(srv, 0, sizeof(*srv));
+
+  if (family == AF_INET6)
+  {
+    struct sockaddr_in6 *in6 = (struct sockaddr_in6 *)&srv->addr;
+
+    in6->sin6_family = AF_INET6;
+    in6->sin6_port = htons(FDNS_PORT);
+    memcpy(&in6->sin6_addr, addr, sizeof(in6->sin6_addr));
+    srv->addrlen = sizeof(*in6);
+    ++i6;
+  }
+  else
+  {
+    struct sockaddr_in *in = (struct sockaddr_in *)&srv->addr;
+
+    in->sin_family = AF_INET;
+    in->sin_port = htons(FDNS_PORT);
+    memcpy(&in->sin_addr, addr, sizeof(in->sin_addr));
+    srv->addrlen = sizeof(*in);
+    ++i4;
+  }
+}
+
 /*
  * These little hacks are here to avoid alignment and type sizing issues completely by doing manual copies
  */
@@ -248,8 +409,9 @@ firedns_fill_rr(struct s_rr_middle *restrict const rr, const unsigned char *cons
   rr->rdlength = input[8] * 256 + input[9];
 }
 
+/* the header fields only; the payload is read where it is, after input[12] */
 static inline void
-firedns_fill_header(struct s_header *const restrict header, const unsigned char *const restrict input, const int l)
+firedns_fill_header(struct s_header *const restrict header, const unsigned char *const restrict input)
 {
   header->id[0] = input[0];
   header->id[1] = input[1];
@@ -259,7 +421,6 @@ firedns_fill_header(struct s_header *const restrict header, const unsigned char
   header->ancount = input[6] * 256 + input[7];
   header->nscount = input[8] * 256 + input[9];
   header->arcount = input[10] * 256 + input[11];
-  memcpy(header->payload, &input[12], l);
 }
 
 static inline void
@@ -280,599 +441,1204 @@ firedns_empty_header(unsigned char *const restrict output, const struct s_header
   memcpy(&output[12], header->payload, l);
 }
 
-/* immediate A query */
-struct in_addr *
-firedns_resolveip4(const char *const name)
+/*
+ * build, add and send specified query; the result is handed to
+ * callback along with info once it arrives, or once the query failed.
+ * Returns 0 if the query was sent, -1 with firedns_errno set otherwise,
+ * in which case callback is not called. A query held back by
+ * dns_fdlimit (FDNS_ERR_FDLIMIT) stays queued and is sent later; it
+ * does get its callback. If the same name is already being looked up
+ * for the same callback, info waits for that answer instead of another
+ * query being sent.
+ */
+int
+firedns_getip(int type, const char *const name, FIREDNS_CB *callback, void *info)
 {
-  static struct in_addr addr;
-
-  if (inet_pton(AF_INET, name, &addr) > 0)
-    return &addr;
-
-  return firedns_resolveip(FDNS_QRY_A, name);
-}
+  struct s_connection *s = firedns_find_name(type, name, callback);
 
-/* immediate AAAA query */
-struct in6_addr *
-firedns_resolveip6(const char *const name)
-{
-  static struct in6_addr addr;
+  if (s)
+  {
+    list_add(&s->waiters, node_create(info));
 
-  if (inet_pton(AF_INET6, name, &addr) > 0)
-    return &addr;
+    if (s->start == 0)
+    {
+      firedns_errno = FDNS_ERR_FDLIMIT;
+      return -1;
+    }
 
-  return firedns_resolveip(FDNS_QRY_AAAA, name);
-}
+    firedns_errno = FDNS_ERR_NONE;
+    return 0;
+  }
 
-/* resolve a query of a given type */
-void *
-firedns_resolveip(int type, const char *const name)
-{
-  struct firedns_result *result;
-  struct timeval tv;
-  fd_set s;
+  s = firedns_add_query(type, name, callback, info);
 
-  for (unsigned int t = 0; t < FIREDNS_TRIES; ++t)
+  if (firedns_inflight >= OptionsItem->dns_fdlimit)
   {
-    int fd = firedns_getip(type, name, NULL);
-    if (fd == -1)
-      return NULL;
-
-    tv.tv_sec = 5;
-    tv.tv_usec = 0;
-    FD_ZERO(&s);
-    FD_SET(fd, &s);
-    select(fd + 1, &s, NULL, NULL, &tv);
-
-    result = firedns_getresult(fd);
-
-    if (firedns_errno == FDNS_ERR_NONE)
-      /*
-       * Return is from static memory in getresult, so there is no need to
-       * copy it until the next call to firedns.
-       */
-      return result->text;
-    else if (firedns_errno == FDNS_ERR_NXDOMAIN)
-      return NULL;
+    list_add(&DEFERRED, &s->node);
+    firedns_errno = FDNS_ERR_FDLIMIT;
+    return -1;
   }
 
-  if (firedns_errno == FDNS_ERR_NONE)
-    firedns_errno = FDNS_ERR_TIMEOUT;
+  if (firedns_doquery(s) == -1)
+  {
+    firedns_remove(s);
+    xfree(s);
+    return -1;
+  }
 
-  return NULL;
+  return 0;
 }
 
-/*
- * build, add and send specified query; retrieve result with
- * firedns_getresult()
- */
-int
-firedns_getip(int type, const char *const name, void *info)
+/* build DNS query with an unused ID, add to the ID and name hashes */
+static struct s_connection *
+firedns_add_query(int type, const char *const name, FIREDNS_CB *callback, void *info)
 {
   struct s_connection *s;
-  node_t *node;
+  struct s_connection **bucket;
 
-  s = firedns_add_query();
+  /* create new connection object */
+  s = xcalloc(sizeof(*s));
   s->class = 1;
   s->type = type;
+  s->callback = callback;
   s->info = info;
+  s->fd4 = -1;
+  s->fd6 = -1;
+  s->server[0] = s->server[1] = -1;
   strlcpy(s->lookup, name, sizeof(s->lookup));
 
-  if (firedns_fdinuse >= OptionsItem->dns_fdlimit)
-  {
-    firedns_errno = FDNS_ERR_FDLIMIT;
-
-    /* Don't add to queue if there is no info */
-    if (info == NULL)
-      xfree(s);
-    else
-    {
-      node = node_create(s);
-      list_add(&CONNECTIONS, node);
-    }
+  /* verified by firedns_event() */
+  do
+    s->id = firedns_random();
+  while (firedns_find(s->id));
 
-    return -1;
-  }
+  bucket = &idhash[s->id % FIREDNS_IDHASH];
+  s->hnext = *bucket;
+  *bucket = s;
 
-  int fd = firedns_doquery(s);
-  if (fd == -1)
-  {
-    xfree(s);
-    return -1;
-  }
+  bucket = &namehash[firedns_hash_name(type, s->lookup)];
+  s->nnext = *bucket;
+  *bucket = s;
 
-  node = node_create(s);
-  list_add(&CONNECTIONS, node);
+  s->node.data = s;
 
-  return fd;
+  return s;
 }
 
-/* build DNS query, add to list */
+/* find the query in flight or deferred with the given ID */
 static struct s_connection *
-firedns_add_query(void)
+firedns_find(uint16_t id)
 {
   struct s_connection *s;
 
-  /* create new connection object */
-  s = xcalloc(sizeof(*s));
-
-  /* verified by firedns_getresult() */
-  s->id[0] = rand() % 255;
-  s->id[1] = rand() % 255;
-  s->fd = -1;
+  for (s = idhash[id % FIREDNS_IDHASH]; s; s = s->hnext)
+    if (s->id == id)
+      break;
 
   return s;
 }
 
-static int
-firedns_doquery(struct s_connection *s)
+/* bucket in namehash of a query, names compared without case */
+static unsigned int
+firedns_hash_name(int type, const char *name)
 {
-  struct s_header h;
+  uint32_t h = 2166136261u ^ (uint32_t)type;  /* FNV-1a */
 
-  int len = firedns_build_query_payload(s->lookup, s->type, 1, (unsigned char *)&h.payload);
-  if (len == -1)
+  for (; *name; ++name)
   {
-    firedns_errno = FDNS_ERR_FORMAT;
-    return -1;
+    h ^= (unsigned char)tolower((unsigned char)*name);
+    h *= 16777619u;
   }
 
-  return firedns_send_requests(&h, s, len);
+  return h % FIREDNS_IDHASH;
+}
+
+/* find the query in flight or deferred for the given type, name and callback */
+static struct s_connection *
+firedns_find_name(int type, const char *name, FIREDNS_CB *callback)
+{
+  struct s_connection *s;
+
+  for (s = namehash[firedns_hash_name(type, name)]; s; s = s->nnext)
+    if (s->type == type && s->callback == callback && strcasecmp(s->lookup, name) == 0)
+      break;
+
+  return s;
 }
 
 /*
- * populate payload with query: name= question, rr= record type
+ * unlink a query from the hashes and from INFLIGHT, if it was sent.
+ * The caller unlinks queries still on DEFERRED.
  */
-static int
-firedns_build_query_payload(const char *const name, uint16_t rr, uint16_t class,
-                            unsigned char *payload)
+static void
+firedns_remove(struct s_connection *s)
 {
-  int16_t payloadpos = 0;
-  const char *tempchr, *tempchr2;
-  uint16_t l;
+  struct s_connection **p = &idhash[s->id % FIREDNS_IDHASH];
 
-  tempchr2 = name;
+  while (*p != s)
+    p = &(*p)->hnext;
 
-  /* split name up into labels, create query */
-  while ((tempchr = strchr(tempchr2, '.')))
+  *p = s->hnext;
+
+  p = &namehash[firedns_hash_name(s->type, s->lookup)];
+
+  while (*p != s)
+    p = &(*p)->nnext;
+
+  *p = s->nnext;
+
+  if (s->hedge_at)
   {
-    l = tempchr - tempchr2;
+    list_remove(&servers[s->server[0]].hedge, &s->hedge_node);
+    s->hedge_at = 0;
+  }
 
-    if (payloadpos + l + 1 > 507)
-      return -1;
+  if (s->tcp)
+  {
+    list_remove(&s->tcp->queries, &s->hedge_node);
+    s->tcp = NULL;
+  }
 
-    payload[payloadpos++] = l;
-    memcpy(&payload[payloadpos], tempchr2, l);
-    payloadpos += l;
-    tempchr2 = &tempchr[1];
+  if (s->start)
+  {
+    list_remove(&INFLIGHT, &s->node);
+    --firedns_inflight;
   }
+}
 
-  l = strlen(tempchr2);
+/*
+ * hand result to the callback of the request that sent the removed
+ * query s and of every request that waited on it, then free s
+ */
+static void
+firedns_deliver(struct s_connection *s, struct firedns_result *result)
+{
+  const int error = firedns_errno;
 
-  if (l)
+  s->callback(result);
+
+  while (s->waiters.tail)
   {
-    if (payloadpos + l + 2 > 507)
-      return -1;
+    node_t *node = s->waiters.tail;
 
-    payload[payloadpos++] = l;
-    memcpy(&payload[payloadpos], tempchr2, l);
-    payloadpos += l;
-    payload[payloadpos++] = '\0';
+    list_remove(&s->waiters, node);
+    result->info = node->data;
+    node_free(node);
+
+    firedns_errno = error;
+    s->callback(result);
   }
 
-  if (payloadpos > 508)
-    return -1;
+  xfree(s);
+}
 
-  l = htons(rr);
-  memcpy(&payload[payloadpos], &l, 2);
+/* finish a query without an answer, reporting error to its callback */
+static void
+firedns_fail(struct s_connection *s, int error)
+{
+  struct firedns_result result;
 
-  l = htons(class);
-  memcpy(&payload[payloadpos + 2], &l, 2);
+  firedns_remove(s);
 
-  return payloadpos + 4;
+  memset(result.text, 0, sizeof(result.text));
+  result.info = s->info;
+  result.type = s->type;
+  result.count = 0;
+  result.ttl = 0;
+  strlcpy(result.lookup, s->lookup, sizeof(result.lookup));
+
+  firedns_errno = error;
+  firedns_deliver(s, &result);
 }
 
-/* send DNS query */
+/*
+ * send a query from the shared sockets to the best server, add it to
+ * INFLIGHT. It goes to a second server if the first one is slow to
+ * answer; see firedns_cycle().
+ */
 static int
-firedns_send_requests(struct s_header *h, struct s_connection *s, int l)
+firedns_doquery(struct s_connection *s)
 {
-  int sent_ok = 0;
-  struct sockaddr_in addr4;
-  struct sockaddr_in6 addr6;
-  unsigned char payload[sizeof(struct s_header)];
-
-  /* set header flags */
-  h->id[0] = s->id[0];
-  h->id[1] = s->id[1];
-  h->flags1 = 0 | FLAGS1_MASK_RD;
-  h->flags2 = 0;
-  h->qdcount = 1;
-  h->ancount = 0;
-  h->nscount = 0;
-  h->arcount = 0;
+  static unsigned int probe;
+  unsigned int tried = 0;
+  int server = -1;
 
-  /* try to create ipv6 or ipv4 socket */
-  s->v6 = 0;
+  s->fd4 = i4 ? firedns_socket(sockets4, AF_INET) : -1;
+  s->fd6 = i6 ? firedns_socket(sockets6, AF_INET6) : -1;
+  s->server[0] = s->server[1] = -1;
 
-  if (i6 > 0)
+  /* Now and then try another server, so one that got better is noticed */
+  if (++probe % FIREDNS_PROBE == 0 && nservers > 1)
   {
-    s->fd = socket(AF_INET6, SOCK_DGRAM, 0);
-
-    if (s->fd != -1)
-    {
-      if (fcntl(s->fd, F_SETFL, O_NONBLOCK))
-      {
-        close(s->fd);
-        s->fd = -1;
-      }
-    }
+    server = (probe / FIREDNS_PROBE) % nservers;
 
-    if (s->fd != -1)
+    if (firedns_send(s, server) == -1)
     {
-      memset(&addr6, 0, sizeof(addr6));
-      addr6.sin6_family = AF_INET6;
-
-      if (bind(s->fd, (struct sockaddr *)&addr6, sizeof(addr6)) == 0)
-        s->v6 = 1;
-      else
-        close(s->fd);
+      tried |= 1u << server;
+      server = -1;
     }
   }
 
-  if (s->v6 == 0)
+  while (server == -1)
   {
-    s->fd = socket(AF_INET, SOCK_DGRAM, 0);
-
-    if (s->fd != -1)
-    {
-      if (fcntl(s->fd, F_SETFL, O_NONBLOCK))
-      {
-        close(s->fd);
-        s->fd = -1;
-      }
-    }
-
-    if (s->fd != -1)
+    if ((server = firedns_server_pick(s, tried)) == -1)
     {
-      memset(&addr4, 0, sizeof(addr4));
-      addr4.sin_family = AF_INET;
-      addr4.sin_port = 0;
-      addr4.sin_addr.s_addr = INADDR_ANY;
-
-      if (bind(s->fd, (struct sockaddr *)&addr4, sizeof(addr4)) != 0)
-      {
-        close(s->fd);
-        s->fd = -1;
-      }
+      firedns_errno = FDNS_ERR_NETWORK;
+      return -1;
     }
 
-    if (s->fd == -1)
+    if (firedns_send(s, server) == -1)
     {
-      firedns_errno = FDNS_ERR_NETWORK;
-      return -1;
+      tried |= 1u << server;
+      server = -1;
     }
   }
 
-  firedns_empty_header(payload, h, l);
+  ++servers[server].sent;
+  s->server[0] = server;
+  s->sent[0] = event_now();
+  time(&s->start);
 
-  /* if we've got ipv6 support, an ip v6 socket, and ipv6 servers, send to them */
-  if (i6 > 0 && s->v6 == 1)
+  if (nservers > 1)
   {
-    for (unsigned int i = 0; i < i6; ++i)
-    {
-      memset(&addr6, 0, sizeof(addr6));
-      memcpy(&addr6.sin6_addr, &servers6[i], sizeof(addr6.sin6_addr));
+    s->hedge_at = s->sent[0] + firedns_hedge_delay(&servers[server]);
+    s->hedge_node.data = s;
+    list_add(&servers[server].hedge, &s->hedge_node);
+  }
 
-      addr6.sin6_family = AF_INET6;
-      addr6.sin6_port = htons(FDNS_PORT);
+  list_add(&INFLIGHT, &s->node);
+  ++firedns_inflight;
+  return 0;
+}
 
-      if (sendto(s->fd, payload, l + 12, 0, (struct sockaddr *)&addr6, sizeof(addr6)) > 0)
-        sent_ok = 1;
-    }
-  }
+/*
+ * the server to send s to, the one expected to answer soonest given its
+ * round trip time and how many queries it lost. Servers in the bitmask
+ * exclude, and those of an address family without a socket, are
+ * skipped. Returns -1 if there is none left.
+ */
+static int
+firedns_server_pick(const struct s_connection *s, unsigned int exclude)
+{
+  const uint64_t timeout = (uint64_t)OptionsItem->dns_timeout * 1000;
+  uint64_t best_score = 0;
+  int best = -1;
 
-  for (unsigned int i = 0; i < i4; ++i)
+  for (unsigned int i = 0; i < nservers; ++i)
   {
-    /* send via ipv4-over-ipv6 if we've got an ipv6 socket */
-    if (s->v6 == 1)
-    {
-      memset(&addr6, 0, sizeof(addr6));
-      memcpy(addr6.sin6_addr.s6_addr, "\0\0\0\0\0\0\0\0\0\0\xff\xff", 12);
-      memcpy(&addr6.sin6_addr.s6_addr[12], &servers4[i].s_addr, 4);
-      addr6.sin6_family = AF_INET6;
-      addr6.sin6_port = htons(FDNS_PORT);
+    const struct s_server *srv = &servers[i];
+    uint64_t score;
 
-      if (sendto(s->fd, payload, l + 12, 0, (struct sockaddr *)&addr6, sizeof(addr6)) > 0)
-        sent_ok = 1;
+    if (exclude & (1u << i))
+      continue;
 
+    if ((srv->addr.ss_family == AF_INET6 ? s->fd6 : s->fd4) == -1)
       continue;
-    }
 
-    /* otherwise send via standard ipv4 boringness */
-    memset(&addr4, 0, sizeof(addr4));
-    memcpy(&addr4.sin_addr, &servers4[i], sizeof(addr4.sin_addr));
-    addr4.sin_family = AF_INET;
-    addr4.sin_port = htons(FDNS_PORT);
+    /* Servers that never answered are tried first; loss costs the timeout */
+    score = (srv->answered ? srv->srtt : 0) + timeout * srv->loss / 1000;
 
-    if (sendto(s->fd, payload, l + 12, 0, (struct sockaddr *)&addr4, sizeof(addr4)) > 0)
-      sent_ok = 1;
+    if (best == -1 || score < best_score)
+    {
+      best = i;
+      best_score = score;
+    }
   }
 
-  if (!sent_ok)
-  {
-    close(s->fd);
-    s->fd = -1;
-    firedns_errno = FDNS_ERR_NETWORK;
-    return -1;
-  }
+  return best;
+}
 
-  time(&s->start);
-  firedns_fdinuse++;
-  firedns_errno = FDNS_ERR_NONE;
+/*
+ * how long to wait for srv before asking another server as well: about
+ * the 95th percentile of its round trip time
+ */
+static uint64_t
+firedns_hedge_delay(const struct s_server *srv)
+{
+  const uint64_t max = (uint64_t)OptionsItem->dns_timeout * 1000 / 2;
+  uint64_t delay = FIREDNS_HEDGE_DEFAULT;
+
+  if (srv->answered)
+    delay = srv->srtt + 2 * srv->rttvar;
 
-  return s->fd;
+  if (delay < FIREDNS_HEDGE_MIN)
+    delay = FIREDNS_HEDGE_MIN;
+
+  return delay < max ? delay : max;
 }
 
-/* retrieve result of DNS query */
-struct firedns_result *
-firedns_getresult(const int fd)
+/* send s to a second server, the first one did not answer in time */
+static void
+firedns_hedge(struct s_connection *s)
 {
-  static struct firedns_result result;
-  struct s_header h;
-  struct s_connection *c;
-  node_t *node;
-  int l, i, q, curanswer;
-  struct s_rr_middle rr = { .rdlength = 0 };
-  unsigned char buffer[sizeof(struct s_header)];
+  const int server = firedns_server_pick(s, 1u << s->server[0]);
 
-  firedns_errno = FDNS_ERR_OTHER;
-  result.info = NULL;
+  if (server == -1 || firedns_send(s, server) == -1)
+    return;
 
-  memset(result.text, 0, sizeof(result.text));
+  ++servers[server].sent;
+  ++servers[server].hedged;
+  s->server[1] = server;
+  s->sent[1] = event_now();
+}
+
+/*
+ * update the round trip time of the server that answered s, and count
+ * a loss for the other one if it had longer to answer
+ */
+static void
+firedns_answered(const struct s_connection *s, int server)
+{
+  const int k = server == s->server[1];
+  struct s_server *srv = &servers[server];
+  const unsigned int rtt = event_now() - s->sent[k];
 
-  /* Find query in list of dns lookups */
-  LIST_FOREACH(node, CONNECTIONS.head)
+  if (srv->answered++ == 0)
+  {
+    srv->srtt = rtt;
+    srv->rttvar = rtt / 2;
+  }
+  else
   {
-    c = node->data;
+    /* The estimator of TCP, RFC 6298 */
+    const int err = (int)rtt - (int)srv->srtt;
 
-    if (c->fd == fd)
-      break;
-    else
-      c = NULL;
+    srv->rttvar += ((err < 0 ? -err : err) - (int)srv->rttvar) / 4;
+    srv->srtt += err / 8;
   }
 
-  /* query not found */
-  if (c == NULL)
-    return &result;
+  srv->loss -= srv->loss / 8;
 
-  /* query found -- we remove in cleanup */
-  l = recv(c->fd, buffer, sizeof(struct s_header), 0);
+  if (k == 1)
+    firedns_lost(&servers[s->server[0]]);
+}
 
-  result.info = c->info;
-  strlcpy(result.lookup, c->lookup, sizeof(result.lookup));
+/* count a query srv did not answer */
+static void
+firedns_lost(struct s_server *srv)
+{
+  ++srv->lost;
+  srv->loss += (1000 - srv->loss) / 8;
+}
 
-  if (l == -1)
+/*
+ * 16 bits from the system's random source, so query IDs cannot be
+ * predicted by someone trying to spoof answers. Falls back to rand()
+ * if /dev/urandom cannot be read.
+ */
+static uint16_t
+firedns_random(void)
+{
+  static uint16_t pool[256];
+  static unsigned int left;
+
+  if (left == 0)
   {
-    firedns_errno = FDNS_ERR_NETWORK;
-    goto cleanup;
-  }
+    int fd = open("/dev/urandom", O_RDONLY);
 
-  if (l < 12)
-    goto cleanup;
+    if (fd == -1 || read(fd, pool, sizeof(pool)) != sizeof(pool))
+      for (unsigned int i = 0; i < 256; ++i)
+        pool[i] = rand() & 0xffff;
 
-  firedns_fill_header(&h, buffer, l - 12);
+    if (fd != -1)
+      close(fd);
 
-  if (c->id[0] != h.id[0] || c->id[1] != h.id[1])
-    /*
-     * ID mismatch: we keep the connection, as this could be an answer to
-     * a previous lookup..
-     */
-    return NULL;
+    left = 256;
+  }
 
-  if ((h.flags1 & FLAGS1_MASK_QR) == 0)
-    goto cleanup;
+  return pool[--left];
+}
 
-  if ((h.flags1 & FLAGS1_MASK_OPCODE) != 0)
-    goto cleanup;
+/* open a non-blocking UDP socket bound to a port of the kernel's choice */
+static int
+firedns_socket_open(int family)
+{
+  struct sockaddr_storage local;
+  socklen_t len = family == AF_INET6 ? sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+  int fd = socket(family, SOCK_DGRAM, 0);
 
-  if ((h.flags2 & FLAGS2_MASK_RCODE) != 0)
+  if (fd == -1)
+    return -1;
+
+  memset(&local, 0, sizeof(local));
+  local.ss_family = family;
+
+  if (fcntl(fd, F_SETFL, O_NONBLOCK) || bind(fd, (struct sockaddr *)&local, len))
   {
-    firedns_errno = (h.flags2 & FLAGS2_MASK_RCODE);
-    goto cleanup;
+    close(fd);
+    return -1;
   }
 
-  if (h.ancount < 1)
+  return fd;
+}
+
+/*
+ * Pick one of the long-lived sockets of a family at random to send a
+ * query from. A socket that sent FIREDNS_SOCKET_QUERIES queries is
+ * replaced by a fresh one, on a new source port; the old one stays
+ * open until answers to what was sent from it can no longer arrive.
+ */
+static int
+firedns_socket(struct s_socket *pool, int family)
+{
+  struct s_socket *sock = &pool[firedns_random() % FIREDNS_SOCKETS];
+
+  if (sock->fd > -1 && sock->queries >= FIREDNS_SOCKET_QUERIES && sock->old_fd == -1)
   {
-    firedns_errno = FDNS_ERR_NXDOMAIN;
-    /* no sense going on if we don't have any answers */
-    goto cleanup;
+    sock->old_fd = sock->fd;
+    sock->fd = -1;
+    time(&sock->retired);
   }
 
-  /* skip queries */
-  i = 0;
-  q = 0;
-  l -= 12;
+  if (sock->fd == -1)
+  {
+    sock->fd = firedns_socket_open(family);
+    sock->queries = 0;
+  }
+
+  if (sock->fd > -1)
+    ++sock->queries;
+
+  return sock->fd;
+}
+
+/*
+ * populate payload with query: name= question, rr= record type
+ */
+static int
+firedns_build_query_payload(const char *const name, uint16_t rr, uint16_t class,
+                            unsigned char *payload)
+{
+  int16_t payloadpos = 0;
+  const char *tempchr, *tempchr2;
+  uint16_t l;
+
+  tempchr2 = name;
+
+  /* split name up into labels, create query */
+  while ((tempchr = strchr(tempchr2, '.')))
+  {
+    l = tempchr - tempchr2;
+
+    if (payloadpos + l + 1 > 507)
+      return -1;
+
+    payload[payloadpos++] = l;
+    memcpy(&payload[payloadpos], tempchr2, l);
+    payloadpos += l;
+    tempchr2 = &tempchr[1];
+  }
+
+  l = strlen(tempchr2);
+
+  if (l)
+  {
+    if (payloadpos + l + 2 > 507)
+      return -1;
+
+    payload[payloadpos++] = l;
+    memcpy(&payload[payloadpos], tempchr2, l);
+    payloadpos += l;
+    payload[payloadpos++] = '\0';
+  }
+
+  if (payloadpos > 508)
+    return -1;
+
+  l = htons(rr);
+  memcpy(&payload[payloadpos], &l, 2);
+
+  l = htons(class);
+  memcpy(&payload[payloadpos + 2], &l, 2);
+
+  return payloadpos + 4;
+}
+
+/*
+ * write the query packet of s to packet, which has room for a struct
+ * s_header. Unless dns_udp_size is 0 an EDNS0 OPT record offers the
+ * nameserver to send replies of up to that size (RFC 6891). Returns the
+ * length of the packet, -1 if the name does not fit.
+ */
+static int
+firedns_build_packet(const struct s_connection *s, unsigned char *packet)
+{
+  unsigned int size = OptionsItem->dns_udp_size;
+  struct s_header h;
+
+  int l = firedns_build_query_payload(s->lookup, s->type, s->class, (unsigned char *)&h.payload);
+  if (l == -1 || l + FIREDNS_OPT_SIZE > (int)sizeof(h.payload))
+    return -1;
+
+  /* set header flags */
+  h.id[0] = s->id >> 8;
+  h.id[1] = s->id & 0xff;
+  h.flags1 = 0 | FLAGS1_MASK_RD;
+  h.flags2 = 0;
+  h.qdcount = 1;
+  h.ancount = 0;
+  h.nscount = 0;
+  h.arcount = 0;
+
+  if (size)
+  {
+    unsigned char *const opt = &h.payload[l];
+
+    if (size < 512)
+      size = 512;
+    if (size > FIREDNS_UDP_MAX)
+      size = FIREDNS_UDP_MAX;
+
+    /* root name, type OPT, the size as class, no extended flags or data */
+    memset(opt, 0, FIREDNS_OPT_SIZE);
+    opt[2] = 41;
+    opt[3] = size >> 8;
+    opt[4] = size & 0xff;
+
+    h.arcount = 1;
+    l += FIREDNS_OPT_SIZE;
+  }
+
+  firedns_empty_header(packet, &h, l);
+  return l + 12;
+}
+
+/*
+ * send DNS query s to servers[server], from s->fd6 if it is an IPv6
+ * one and from s->fd4 otherwise
+ */
+static int
+firedns_send(struct s_connection *s, int server)
+{
+  struct s_server *const srv = &servers[server];
+  const int fd = srv->addr.ss_family == AF_INET6 ? s->fd6 : s->fd4;
+  unsigned char packet[sizeof(struct s_header)];
+
+  int l = firedns_build_packet(s, packet);
+  if (l == -1)
+  {
+    firedns_errno = FDNS_ERR_FORMAT;
+    return -1;
+  }
+
+  if (fd == -1 || sendto(fd, packet, l, 0, (struct sockaddr *)&srv->addr, srv->addrlen) <= 0)
+  {
+    firedns_errno = FDNS_ERR_NETWORK;
+    return -1;
+  }
+
+  firedns_errno = FDNS_ERR_NONE;
+
+  return 0;
+}
 
-  while (q < h.qdcount && i < l)
+/*
+ * read one datagram of up to size bytes from fd into buffer. Returns
+ * its length, 0 if it has to be ignored because it is too short or does
+ * not come from one of our nameservers, or -1 if there is nothing (more)
+ * to read. The index in servers of the sender goes to server.
+ */
+static int
+firedns_recv(int fd, unsigned char *buffer, size_t size, int *server)
+{
+  struct sockaddr_storage from;
+  socklen_t fromlen = sizeof(from);
+  int l = recvfrom(fd, buffer, size, 0, (struct sockaddr *)&from, &fromlen);
+
+  if (l == -1)
+    return -1;
+
+  if (l < 12)
+    return 0;
+
+  for (unsigned int i = 0; i < nservers; ++i)
   {
-    if (h.payload[i] > 63)
+    const struct s_server *srv = &servers[i];
+
+    if (srv->addr.ss_family != from.ss_family)
+      continue;
+
+    if (from.ss_family == AF_INET)
     {
-      /* pointer */
-      i += 6;  /* skip pointer, class and type */
-      q++;
+      const struct sockaddr_in *in = (const struct sockaddr_in *)&from;
+      const struct sockaddr_in *sin = (const struct sockaddr_in *)&srv->addr;
+
+      if (in->sin_port != sin->sin_port || in->sin_addr.s_addr != sin->sin_addr.s_addr)
+        continue;
     }
     else
     {
-      /* label */
-      if (h.payload[i] == 0)
-      {
-        q++;
-        i += 5;  /* skip nil, class and type */
-      }
-      else
-        i += h.payload[i] + 1;  /* skip length and label */
+      const struct sockaddr_in6 *in6 = (const struct sockaddr_in6 *)&from;
+      const struct sockaddr_in6 *sin6 = (const struct sockaddr_in6 *)&srv->addr;
+
+      if (in6->sin6_port != sin6->sin6_port ||
+          memcmp(&in6->sin6_addr, &sin6->sin6_addr, sizeof(in6->sin6_addr)))
+        continue;
     }
+
+    *server = i;
+    return l;
   }
 
-  /* &h.payload[i] should now be the start of the first response */
-  curanswer = 0;
+  return 0;
+}
+
+/*
+ * parse the reply in buffer to query c into result, setting
+ * firedns_errno. Returns -1 if the reply does not answer the question
+ * of c after all and has to be ignored, 0 otherwise.
+ */
+static int
+firedns_parse(const struct s_connection *c, const unsigned char *buffer, int l, struct firedns_result *result)
+{
+  struct s_header h;
+  int i;
+  struct s_rr_middle rr;
+  unsigned char question[sizeof(h.payload)];
+  const unsigned char *const payload = &buffer[12];
+
+  firedns_errno = FDNS_ERR_OTHER;
+  result->info = c->info;
+  result->type = c->type;
+  result->count = 0;
+  result->ttl = 0;
+  strlcpy(result->lookup, c->lookup, sizeof(result->lookup));
+
+  memset(result->text, 0, sizeof(result->text));
+
+  firedns_fill_header(&h, buffer);
+  l -= 12;
+
+  if ((h.flags1 & FLAGS1_MASK_QR) == 0)
+    return -1;
+
+  if ((h.flags1 & FLAGS1_MASK_OPCODE) != 0)
+    return -1;
+
+  /*
+   * The question has to be echoed back unchanged, apart from the case of
+   * the name. Only errors may come without it.
+   */
+  int qlen = firedns_build_query_payload(c->lookup, c->type, c->class, question);
 
-  while (curanswer < h.ancount)
+  if (h.qdcount || (h.flags2 & FLAGS2_MASK_RCODE) == 0)
   {
-    q = 0;
+    if (qlen == -1 || h.qdcount != 1 || l < qlen)
+      return -1;
+
+    for (i = 0; i < qlen; ++i)
+      if (tolower(question[i]) != tolower(payload[i]))
+        return -1;
+  }
+
+  if ((h.flags2 & FLAGS2_MASK_RCODE) != 0)
+  {
+    firedns_errno = (h.flags2 & FLAGS2_MASK_RCODE);
+
+    if (firedns_errno == FDNS_ERR_NXDOMAIN)
+      result->ttl = firedns_soa_ttl(&h, payload, h.qdcount ? qlen : 0, l);
+    return 0;
+  }
+
+  if (h.ancount < 1)
+  {
+    firedns_errno = FDNS_ERR_NXDOMAIN;
+    result->ttl = firedns_soa_ttl(&h, payload, qlen, l);
+    /* no sense going on if we don't have any answers */
+    return 0;
+  }
+
+  /*
+   * &payload[qlen] should now be the start of the first response. Take
+   * every record of the type asked for, the lowest TTL among them being
+   * that of the answer.
+   */
+  i = qlen;
+
+  for (int n = 0; n < h.ancount; ++n)
+  {
+    if ((i = firedns_skip_name(payload, i, l)) == -1 || l - i < 10)
+      break;
+
+    firedns_fill_rr(&rr, &payload[i]);
+    i += 10;
+
+    if (i + rr.rdlength > l)
+      break;
 
-    while (q == 0 && i < l)
+    if (rr.type == c->type && rr.class == c->class)
     {
-      if (h.payload[i] > 63)
-      {
-        /* pointer */
-        i += 2;  /* skip pointer */
-        q = 1;
-      }
-      else
-      {
-        /* label */
-        if (h.payload[i] == 0)
-        {
-          i++;
-          q = 1;
-        }
-        else
-          i += h.payload[i] + 1;  /* skip length and label */
-      }
+      if (result->count == 0 || rr.ttl < result->ttl)
+        result->ttl = rr.ttl;
+
+      firedns_add_record(result, c->type, &payload[i], rr.rdlength);
     }
 
-    if (l - i < 10)
-      goto cleanup;
+    i += rr.rdlength;
+  }
+
+  if (result->count)
+    firedns_errno = FDNS_ERR_NONE;
+  else
+    result->ttl = 0;
 
-    firedns_fill_rr(&rr, &h.payload[i]);
-    i += 10;
+  return 0;
+}
 
-    if (rr.type != c->type)
+/*
+ * add the record rdata of type to the text of result, as long as there
+ * is room. TXT strings are copied as text. Anything else is an A or
+ * AAAA record, copied as is if it has the length of an address.
+ */
+static void
+firedns_add_record(struct firedns_result *result, int type, const unsigned char *rdata, unsigned int rdlength)
+{
+  if (type == FDNS_QRY_TXT)
+  {
+    size_t len = strlen(result->text);
+
+    if (result->count && len + 2 < sizeof(result->text) - 1)
     {
-      curanswer++;
-      i += rr.rdlength;
-      continue;
+      memcpy(&result->text[len], "; ", 2);
+      len += 2;
     }
 
-    if (rr.class != c->class)
+    /* Character strings, each after its length */
+    for (unsigned int j = 0; j < rdlength; j += 1 + rdata[j])
     {
-      curanswer++;
-      i += rr.rdlength;
-      continue;
+      unsigned int n = rdata[j];
+
+      if (j + 1 + n > rdlength)
+        break;
+
+      if (n > sizeof(result->text) - 1 - len)
+        n = sizeof(result->text) - 1 - len;
+
+      memcpy(&result->text[len], &rdata[j + 1], n);
+      len += n;
     }
 
-    break;
+    result->text[len] = '\0';
+    ++result->count;
+    return;
   }
 
-  if (curanswer == h.ancount)
-    goto cleanup;
-  if (i + rr.rdlength > l)
-    goto cleanup;
-  if (rr.rdlength > 1023)
-    goto cleanup;
+  if (rdlength != (type == FDNS_QRY_AAAA ? 16u : 4u) ||
+      (result->count + 1) * rdlength > sizeof(result->text) - 1)
+    return;
 
-  firedns_errno = FDNS_ERR_NONE;
-  memcpy(result.text, &h.payload[i], rr.rdlength);
-  result.text[rr.rdlength] = '\0';
+  memcpy(&result->text[result->count * rdlength], rdata, rdlength);
+  ++result->count;
+}
 
-/* Clean-up */
-cleanup:
-  list_remove(&CONNECTIONS, node);
-  node_free(node);
+/*
+ * skip the possibly compressed name at payload[i]; return the offset
+ * right after it, or -1 if it runs past l
+ */
+static int
+firedns_skip_name(const unsigned char *payload, int i, int l)
+{
+  while (i < l)
+  {
+    if (payload[i] > 63)
+      return i + 2 <= l ? i + 2 : -1;  /* pointer ends the name */
 
-  close(c->fd);
-  xfree(c);
-  firedns_fdinuse--;
+    if (payload[i] == 0)
+      return i + 1;
 
-  return &result;
+    i += payload[i] + 1;  /* skip length and label */
+  }
+
+  return -1;
 }
 
-void
-firedns_cycle(void)
+/*
+ * how long a negative answer may be cached: the lower of the TTL of the
+ * SOA record in the authority section and its minimum field, as in
+ * RFC 2308. i is the offset in payload of the first answer. Returns 0
+ * if there is no usable SOA record.
+ */
+static unsigned int
+firedns_soa_ttl(const struct s_header *h, const unsigned char *payload, int i, int l)
 {
-  node_t *node, *node_next;
-  struct s_connection *p;
-  struct firedns_result *res, new_result;
-  static struct pollfd *ufds = NULL;
-  unsigned int size = 0;
-  time_t timenow;
+  struct s_rr_middle rr;
 
-  if (LIST_SIZE(&CONNECTIONS) == 0)
-    return;
+  for (int n = 0; n < h->ancount + h->nscount; ++n)
+  {
+    if ((i = firedns_skip_name(payload, i, l)) == -1 || l - i < 10)
+      return 0;
 
-  if (ufds == NULL)
-    ufds = xcalloc(sizeof(*ufds) * OptionsItem->dns_fdlimit);
+    firedns_fill_rr(&rr, &payload[i]);
+    i += 10;
 
-  time(&timenow);
+    if (i + rr.rdlength > l)
+      return 0;
+
+    if (n >= h->ancount && rr.type == 6)
+    {
+      const int end = i + rr.rdlength;
+      int j = firedns_skip_name(payload, i, end);  /* MNAME */
+
+      if (j != -1)
+        j = firedns_skip_name(payload, j, end);  /* RNAME */
+
+      /* SERIAL, REFRESH, RETRY and EXPIRE come before MINIMUM */
+      if (j == -1 || end - j < 20)
+        return 0;
+
+      const unsigned char *p = &payload[j + 16];
+      const uint32_t minimum = (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+
+      return rr.ttl < minimum ? rr.ttl : minimum;
+    }
+
+    i += rr.rdlength;
+  }
+
+  return 0;
+}
 
-  LIST_FOREACH_SAFE(node, node_next, CONNECTIONS.head)
+/* firedns_event
+ *
+ *    Called from event_wait() once replies are waiting on one of the
+ *    shared sockets. Each is matched to its query by ID and handed to
+ *    the callback of the query. A query whose reply was truncated is
+ *    asked again over TCP; only if that cannot be done does the
+ *    callback get the truncated reply.
+ */
+static void
+firedns_event(int fd, short revents, void *data)
+{
+  for (unsigned int n = 0; n < FIREDNS_READ_BURST; ++n)
   {
-    if (size >= OptionsItem->dns_fdlimit)
+    unsigned char buffer[FIREDNS_UDP_MAX];
+    struct firedns_result result;
+    struct s_connection *c = NULL;
+    int server = -1;
+    int l = firedns_recv(fd, buffer, sizeof(buffer), &server);
+
+    if (l == -1)
       break;
 
-    p = node->data;
+    if (l)
+      c = firedns_find(buffer[0] << 8 | buffer[1]);
 
-    if (p->fd < 0)
+    /*
+     * Unknown ID, not yet sent, from a server it was not sent to, sent
+     * from another port, or a different question
+     */
+    if (c == NULL || c->start == 0 || (server != c->server[0] && server != c->server[1]) ||
+        (fd != c->fd4 && fd != c->fd6) || firedns_parse(c, buffer, l, &result) == -1)
       continue;
 
-    if (p->fd > 0 && (p->start + OptionsItem->dns_timeout) < timenow)
+    if (buffer[2] & FLAGS1_MASK_TC)
     {
-      /* Timed out - remove from list */
-      list_remove(&CONNECTIONS, node);
-      node_free(node);
+      /* Already being asked over TCP, after the other server's reply */
+      if (c->tcp)
+        continue;
 
-      memset(new_result.text, 0, sizeof(new_result.text));
-      new_result.info = p->info;
-      strlcpy(new_result.lookup, p->lookup, sizeof(new_result.lookup));
+      firedns_answered(c, server);
 
-      close(p->fd);
-      xfree(p);
-      firedns_fdinuse--;
+      if (firedns_tcp_query(c, server) == 0)
+        continue;
+    }
+    else
+      firedns_answered(c, server);
 
-      firedns_errno = FDNS_ERR_TIMEOUT;
+    firedns_remove(c);
+    firedns_deliver(c, &result);
+  }
+}
 
-      if (new_result.info)
-        dnsbl_result(&new_result);
+/*
+ * ask s again over the TCP connection to servers[server], opening one
+ * if there is none. The query gets another dns_timeout for that.
+ * Returns -1 if it cannot be queued.
+ */
+static int
+firedns_tcp_query(struct s_connection *s, int server)
+{
+  struct s_server *const srv = &servers[server];
+  struct s_tcp *tcp = srv->conn;
+  unsigned char packet[sizeof(struct s_header)];
+  const int l = firedns_build_packet(s, packet);
+
+  if (l == -1)
+    return -1;
+
+  if (tcp == NULL)
+  {
+    const int fd = socket(srv->addr.ss_family, SOCK_STREAM, 0);
+
+    if (fd == -1)
+      return -1;
+
+    if (fcntl(fd, F_SETFL, O_NONBLOCK) ||
+        (connect(fd, (struct sockaddr *)&srv->addr, srv->addrlen) && errno != EINPROGRESS))
+    {
+      close(fd);
+      return -1;
+    }
+
+    tcp = xcalloc(sizeof(*tcp));
+    tcp->fd = fd;
+    tcp->server = server;
+    srv->conn = tcp;
+  }
+
+  if (tcp->outlen + 2 + l > sizeof(tcp->out))
+    return -1;
+
+  /*
+   * Only queued here; firedns_tcp_event() writes it, so a failed write
+   * never closes the connection while an event for it is pending
+   */
+  tcp->out[tcp->outlen++] = l >> 8;
+  tcp->out[tcp->outlen++] = l & 0xff;
+  memcpy(&tcp->out[tcp->outlen], packet, l);
+  tcp->outlen += l;
+  time(&tcp->last);
 
+  if (s->hedge_at)
+  {
+    list_remove(&servers[s->server[0]].hedge, &s->hedge_node);
+    s->hedge_at = 0;
+  }
+
+  s->tcp = tcp;
+  s->hedge_node.data = s;
+  list_add(&tcp->queries, &s->hedge_node);
+
+  /* Back to the head of INFLIGHT, which is ordered by start */
+  list_remove(&INFLIGHT, &s->node);
+  time(&s->start);
+  list_add(&INFLIGHT, &s->node);
+
+  ++srv->tcp;
+  return 0;
+}
+
+/*
+ * close a TCP connection, failing the queries still waiting on it with
+ * a network error
+ */
+static void
+firedns_tcp_close(struct s_tcp *tcp)
+{
+  servers[tcp->server].conn = NULL;
+  close(tcp->fd);
+
+  while (tcp->queries.tail)
+    firedns_fail(tcp->queries.tail->data, FDNS_ERR_NETWORK);
+
+  xfree(tcp);
+}
+
+/*
+ * hand each complete reply read on tcp to its query, and keep what is
+ * left of an incomplete one for the next read
+ */
+static void
+firedns_tcp_read(struct s_tcp *tcp)
+{
+  size_t pos = 0;
+
+  while (tcp->inlen - pos >= 2)
+  {
+    const size_t l = tcp->in[pos] << 8 | tcp->in[pos + 1];
+    const unsigned char *const buffer = &tcp->in[pos + 2];
+    struct firedns_result result;
+    struct s_connection *c;
+
+    if (tcp->inlen - pos - 2 < l)
+      break;
+
+    pos += 2 + l;
+
+    if (l < 12)
+      continue;
+
+    /* The ID may have been taken by a new query since, so check it is ours */
+    c = firedns_find(buffer[0] << 8 | buffer[1]);
+
+    if (c == NULL || c->tcp != tcp || firedns_parse(c, buffer, l, &result) == -1)
       continue;
+
+    firedns_remove(c);
+    firedns_deliver(c, &result);
+  }
+
+  memmove(tcp->in, &tcp->in[pos], tcp->inlen - pos);
+  tcp->inlen -= pos;
+}
+
+/* firedns_tcp_event
+ *
+ *    Called from event_wait() once a TCP connection to a nameserver
+ *    got connected, can take more of its queued queries or has replies
+ *    to read.
+ */
+static void
+firedns_tcp_event(int fd, short revents, void *data)
+{
+  struct s_tcp *const tcp = data;
+  ssize_t n;
+
+  if (!tcp->connected)
+  {
+    int error = 0;
+    socklen_t len = sizeof(error);
+
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len) || error)
+    {
+      if (error)
+        errno = error;
+
+      firedns_tcp_close(tcp);
+      return;
     }
 
-    ufds[size].events = 0;
-    ufds[size].revents = 0;
-    ufds[size].fd = p->fd;
-    ufds[size].events = POLLIN;
+    tcp->connected = 1;
+  }
 
-    ++size;
+  if ((revents & POLLOUT) && tcp->outlen)
+  {
+    if ((n = send(fd, tcp->out, tcp->outlen, 0)) == -1)
+    {
+      if (errno != EAGAIN && errno != EINTR)
+      {
+        firedns_tcp_close(tcp);
+        return;
+      }
+    }
+    else
+    {
+      tcp->outlen -= n;
+      memmove(tcp->out, &tcp->out[n], tcp->outlen);
+    }
   }
 
-  switch (poll(ufds, size, 0))
+  if (revents & (POLLIN | POLLHUP | POLLERR))
   {
-    case -1:
-    case  0:
+    n = recv(fd, &tcp->in[tcp->inlen], sizeof(tcp->in) - tcp->inlen, 0);
+
+    if (n == 0 || (n == -1 && errno != EAGAIN && errno != EINTR))
+    {
+      firedns_tcp_close(tcp);
       return;
+    }
+
+    if (n > 0)
+    {
+      tcp->inlen += n;
+      time(&tcp->last);
+      firedns_tcp_read(tcp);
+    }
   }
+}
 
-  LIST_FOREACH_SAFE(node, node_next, CONNECTIONS.head)
+/*
+ * close sockets retired by firedns_socket() once their queries timed
+ * out, and watch the others for replies
+ */
+static void
+firedns_watch(struct s_socket *pool, time_t timenow)
+{
+  for (unsigned int i = 0; i < FIREDNS_SOCKETS; ++i)
   {
-    p = node->data;
+    struct s_socket *sock = &pool[i];
 
-    if (p->fd > 0)
+    if (sock->old_fd > -1 && (sock->retired + OptionsItem->dns_timeout) < timenow)
     {
-      for (unsigned int i = 0; i < size; ++i)
-      {
-        if ((ufds[i].revents & POLLIN) && ufds[i].fd == p->fd)
-        {
-          res = firedns_getresult(p->fd);
+      close(sock->old_fd);
+      sock->old_fd = -1;
+    }
 
-          if (res && res->info)
-            dnsbl_result(res);
+    if (sock->fd > -1)
+      event_fd(sock->fd, POLLIN, firedns_event, NULL);
+    if (sock->old_fd > -1)
+      event_fd(sock->old_fd, POLLIN, firedns_event, NULL);
+  }
+}
 
-          break;
-        }
+void
+firedns_cycle(void)
+{
+  struct s_connection *p;
+  time_t timenow;
+  const uint64_t now = event_now();
+  uint64_t next_hedge = 0;
+
+  time(&timenow);
+
+  /* Time out queries, oldest first, until one is still within dns_timeout */
+  while (INFLIGHT.tail)
+  {
+    p = INFLIGHT.tail->data;
+
+    if ((p->start + OptionsItem->dns_timeout) >= timenow)
+      break;
+
+    for (unsigned int k = 0; k < 2; ++k)
+      if (p->server[k] > -1)
+        firedns_lost(&servers[p->server[k]]);
+
+    firedns_fail(p, FDNS_ERR_TIMEOUT);
+  }
+
+  /*
+   * Ask a second server for queries the first one has not answered in
+   * time. Each server's list is in the order queries were sent, so only
+   * the tails need to be looked at.
+   */
+  for (unsigned int i = 0; i < nservers; ++i)
+  {
+    while (servers[i].hedge.tail)
+    {
+      p = servers[i].hedge.tail->data;
+
+      if (p->hedge_at > now)
+      {
+        if (next_hedge == 0 || p->hedge_at < next_hedge)
+          next_hedge = p->hedge_at;
+        break;
       }
+
+      list_remove(&servers[i].hedge, &p->hedge_node);
+      p->hedge_at = 0;
+      firedns_hedge(p);
     }
-    else if (firedns_fdinuse < OptionsItem->dns_fdlimit)
-      firedns_doquery(p);
+  }
+
+  if (next_hedge)
+    event_timeout(next_hedge - now);
+
+  /* Send queries deferred by dns_fdlimit, in order, while there is room */
+  while (DEFERRED.tail && firedns_inflight < OptionsItem->dns_fdlimit)
+  {
+    p = DEFERRED.tail->data;
+    list_remove(&DEFERRED, &p->node);
+
+    if (firedns_doquery(p) == -1)
+      firedns_fail(p, firedns_errno);
+  }
+
+  firedns_watch(sockets4, timenow);
+  firedns_watch(sockets6, timenow);
+
+  /* Close TCP connections idle for a while, watch the others */
+  for (unsigned int i = 0; i < nservers; ++i)
+  {
+    struct s_tcp *const tcp = servers[i].conn;
+
+    if (tcp == NULL)
+      continue;
+
+    if (tcp->queries.tail == NULL && tcp->outlen == 0 && (tcp->last + FIREDNS_TCP_IDLE) < timenow)
+      firedns_tcp_close(tcp);
+    else
+      event_fd(tcp->fd, POLLIN | (tcp->connected && tcp->outlen == 0 ? 0 : POLLOUT),
+               firedns_tcp_event, tcp);
   }
 }
 
@@ -884,3 +1650,32 @@ firedns_strerror(int error)
 
   return errors[error];
 }
+
+/*
+ * copy what is known about nameserver i into stats. Returns -1 if there
+ * is no such server.
+ */
+int
+firedns_server_stats(unsigned int i, struct firedns_server_stats *stats)
+{
+  if (i >= nservers)
+    return -1;
+
+  const struct s_server *srv = &servers[i];
+
+  if (srv->addr.ss_family == AF_INET6)
+    inet_ntop(AF_INET6, &((const struct sockaddr_in6 *)&srv->addr)->sin6_addr, stats->addr, sizeof(stats->addr));
+  else
+    inet_ntop(AF_INET, &((const struct sockaddr_in *)&srv->addr)->sin_addr, stats->addr, sizeof(stats->addr));
+
+  stats->srtt = srv->srtt;
+  stats->rttvar = srv->rttvar;
+  stats->loss = srv->loss;
+  stats->sent = srv->sent;
+  stats->answered = srv->answered;
+  stats->lost = srv->lost;
+  stats->hedged = srv->hedged;
+  stats->tcp = srv->tcp;
+
+  return 0;
+}
@@ -23,6 +23,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #ifndef _FIREDNS_H
 #define _FIREDNS_H
 
+#include <netinet/in.h>
+
 /* max number of nameservers used */
 #define FDNS_MAX              8
 /* preferred firedns config file */
@@ -33,6 +35,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #define FDNS_PORT            53
 /* name to IPv4 address */
 #define FDNS_QRY_A            1
+/* name to text */
+#define FDNS_QRY_TXT         16
 /* name to IPv6 address */
 #define FDNS_QRY_AAAA        28
 
@@ -55,7 +59,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 #define FDNS_ERR_TIMEOUT     6
 /* Network error */
 #define FDNS_ERR_NETWORK     7
-/* FD Limit reached */
+/* Too many queries in flight (dns_fdlimit), query deferred */
 #define FDNS_ERR_FDLIMIT     8
 /* Other error */
 #define FDNS_ERR_OTHER       9
@@ -65,22 +69,41 @@ extern int firedns_errno;
 
 struct firedns_result
 {
+  /*
+   * The records answering the query: one address after the other for
+   * A and AAAA, the strings of each TXT record joined by "; " for TXT
+   */
   char text[1024];
   char lookup[256];
   void *info;
+  int type;  /* FDNS_QRY_* of the query */
+  unsigned int count;  /* Records in text */
+  unsigned int ttl;  /* Lowest TTL of the answer, or of a negative answer per its SOA; 0 if unknown */
 };
 
-/* non-blocking functions */
-extern int firedns_getip(int, const char *const, void *);
-extern struct firedns_result *firedns_getresult(const int);
+/* How a nameserver has been answering, see firedns_server_stats() */
+struct firedns_server_stats
+{
+  char addr[INET6_ADDRSTRLEN];
+  unsigned int srtt;  /* Smoothed round trip time in ms */
+  unsigned int rttvar;  /* Its smoothed mean deviation in ms */
+  unsigned int loss;  /* Smoothed share of queries lost, in 1/1000 */
+  unsigned int sent;
+  unsigned int answered;
+  unsigned int lost;
+  unsigned int hedged;  /* Queries sent after another server was slow */
+  unsigned int tcp;  /* Queries asked again over TCP after a truncated reply */
+};
+
+/* Completion callback of firedns_getip(), with firedns_errno set */
+typedef void FIREDNS_CB(struct firedns_result *);
 
-/* low-timeout blocking functions */
-extern void *firedns_resolveip(int, const char *const);
-extern struct in_addr *firedns_resolveip4(const char *const);
-extern struct in6_addr *firedns_resolveip6(const char *const);
+/* non-blocking functions */
+extern int firedns_getip(int, const char *const, FIREDNS_CB *, void *);
 
 extern void firedns_init(void);
 extern void firedns_cycle(void);
 extern const char *firedns_strerror(int);
+extern int firedns_server_stats(unsigned int, struct firedns_server_stats *);
 
 #endif
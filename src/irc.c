@@ -1,28 +1,3 @@
-<<<<<<< HEAD
-/* vim: set shiftwidth=3 softtabstop=3 expandtab: */ 
-
-/*
- * Copyright (C) 2002-2003  Erik Fears
- *
- * This program is free software; you can redistribute it and/or
- * modify it under the terms of the GNU General Public License
- * as published by the Free Software Foundation; either version 2
- * of the License, or (at your option) any later version.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program; if not, write to
- *
- *       The Free Software Foundation, Inc.
- *       59 Temple Place - Suite 330
- *       Boston, MA  02111-1307, USA.
- *
- *
-=======
 /*
  *  Copyright (c) 2002-2003 Erik Fears
  *  Copyright (c) 2014-2017 ircd-hybrid development team
@@ -41,44 +16,12 @@
  *  along with this program; if not, write to the Free Software
  *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
  *  USA
->>>>>>> remotes/new/master
  */
 
 #include "setup.h"
 
 #include <stdio.h>
 #include <unistd.h>
-<<<<<<< HEAD
-
-#ifdef STDC_HEADERS
-# include <stdlib.h>
-# include <string.h>
-#endif
-
-#ifdef HAVE_STRINGS_H
-# include <strings.h>
-#endif
-
-#include <sys/types.h>
-#include <sys/socket.h>
-#include <netinet/in.h>
-#include <arpa/inet.h>
-
-#ifdef TIME_WITH_SYS_TIME
-# include <sys/time.h>
-# include <time.h>
-#else
-# ifdef HAVE_SYS_TIME_H
-#  include <sys/time.h>
-# else
-#  include <time.h>
-# endif
-#endif
-
-#include <errno.h>
-#include <stdarg.h>
-#include <regex.h>
-=======
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
@@ -89,667 +32,67 @@
 #include <poll.h>
 #include <time.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <stdarg.h>
 #include <regex.h>
 #include <assert.h>
->>>>>>> remotes/new/master
 
 #include "config.h"
+#include "event.h"
 #include "irc.h"
 #include "log.h"
 #include "opercmd.h"
 #include "scan.h"
 #include "dnsbl.h"
 #include "stats.h"
-<<<<<<< HEAD
-#include "extern.h"
-=======
->>>>>>> remotes/new/master
 #include "options.h"
 #include "match.h"
 #include "compat.h"
 #include "negcache.h"
-<<<<<<< HEAD
-#include "malloc.h"
-#include "main.h"
-
-RCSID("$Id$");
-
-static void irc_init(void);
-static void irc_connect(void);
-static void irc_reconnect(void);
-static void irc_read(void);
-static void irc_parse(void);
-
-static struct ChannelConf *get_channel(const char *);
-
-static struct UserInfo *userinfo_create(char *);
-static void userinfo_free(struct UserInfo *source);
-
-static void m_ping(char **, unsigned int, char *, struct UserInfo *);
-static void m_invite(char **, unsigned int, char *, struct UserInfo *);
-static void m_privmsg(char **, unsigned int, char *, struct UserInfo *);
-static void m_ctcp(char **, unsigned int, char *, struct UserInfo *);
-static void m_notice(char **, unsigned int, char *, struct UserInfo *);
-static void m_perform(char **, unsigned int, char *, struct UserInfo *);
-static void m_userhost(char **, unsigned int, char *, struct UserInfo *);
-static void m_cannot_join(char **, unsigned int, char *, struct UserInfo *);
-static void m_kill(char **, unsigned int, char *, struct UserInfo *);
-
-extern struct cnode *nc_head;
-=======
 #include "memory.h"
-#include "main.h"
-#include "serno.h"
-
->>>>>>> remotes/new/master
-
-/*
- * Certain variables we don't want to allocate memory for over and over
- * again so global scope is given.
- */
-<<<<<<< HEAD
-
-char                 IRC_RAW[MSGLENMAX];         /* Buffer to read data into              */
-char                 IRC_SENDBUFF[MSGLENMAX];    /* Send buffer                           */
-char                 IRC_CHANNELS[MSGLENMAX];    /* Stores comma delim list of channels   */
-int                  IRC_RAW_LEN    = 0;         /* Position of IRC_RAW                   */
-
-int                  IRC_FD         = 0;        /* File descriptor for IRC client        */
-
-struct bopm_sockaddr IRC_SVR;                   /* Sock Address Struct for IRC server    */
-struct bopm_ircaddr  IRC_LOCAL;                 /* Sock Address Struct for Bind          */
-
-fd_set               IRC_READ_FDSET;             /* fd_set for IRC (read) data for select()*/
-struct timeval       IRC_TIMEOUT;                /* timeval struct for select() timeout   */
-
-time_t               IRC_LAST = 0;               /* Last full line of data from irc server*/
-time_t               IRC_LASTRECONNECT = 0;      /* Time of last reconnection */
-
-/* Table should be ordered with most occuring (or priority)
-   commands at the top of the list. */
-
-static struct CommandHash COMMAND_TABLE[] = {
-         {"NOTICE",               m_notice         },
-         {"PRIVMSG",              m_privmsg        },
-         {"PING",                 m_ping           },
-         {"INVITE",               m_invite         },
-         {"001",                  m_perform        },
-         {"302",                  m_userhost       },
-         {"471",                  m_cannot_join    },
-         {"473",                  m_cannot_join    },
-         {"474",                  m_cannot_join    },
-         {"475",                  m_cannot_join    },
-         {"KILL",                 m_kill           }
-      };
-
-/* irc_cycle
- *
- *    Pass control to the IRC portion of BOPM to handle any awaiting IRC events.
- *
- * Parameters:
- *    None
- *
- * Return:
- *    None
- *
- */
-
-void irc_cycle(void)
-{
-   if (IRC_FD <= 0)
-   {
-      /* Initialise negative cache. */
-      if (OptionsItem->negcache > 0)
-         nc_init(&nc_head);
-
-      /* Resolve remote host. */
-      irc_init();
-
-      /* Connect to remote host. */
-      irc_connect();
-
-      return;      /* In case connect() immediately failed */ 
-  }
-
-   IRC_TIMEOUT.tv_sec  = 0;
-   /* Block .025 seconds to avoid excessive CPU use on select(). */
-   IRC_TIMEOUT.tv_usec = 25000;
-
-   FD_ZERO(&IRC_READ_FDSET);
-   FD_SET(IRC_FD, &IRC_READ_FDSET);
-
-   switch (select((IRC_FD + 1), &IRC_READ_FDSET, 0, 0, &IRC_TIMEOUT))
-   {
-      case -1:
-         return;
-         break;
-      case 0:
-         break;
-      default:
-         /* Check if IRC data is available. */
-         if (FD_ISSET(IRC_FD, &IRC_READ_FDSET))
-            irc_read();
-         break;
-   }
-}
-
-
-
-
-/* irc_init
- *
- *    Resolve IRC host and perform other initialization.
- *
- * Parameters: 
- *    None
- * 
- * Return:
- *    None
- *
- */
-
-static void irc_init(void)
-{
-   node_t *node;
-   struct ChannelConf *chan;
-   struct bopm_sockaddr bsaddr;
-   struct in_addr *irc_host;
-
-
-   if (IRC_FD)
-      close(IRC_FD);
-
-   memset(&IRC_SVR, 0, sizeof(IRC_SVR));
-   memset(&IRC_LOCAL, 0, sizeof(IRC_LOCAL));
-   memset(&bsaddr, 0, sizeof(struct bopm_sockaddr));
-
-   /* Resolve IRC host. */
-   if ((irc_host = firedns_resolveip4(IRCItem->server)) == NULL)
-   {
-      log_printf("IRC -> firedns_resolveip4(\"%s\"): %s", IRCItem->server,
-            firedns_strerror(fdns_errno));
-      exit(EXIT_FAILURE);
-   }
-
-   IRC_SVR.sa4.sin_family = AF_INET;
-   IRC_SVR.sa4.sin_port = htons(IRCItem->port);
-   IRC_SVR.sa4.sin_addr = *irc_host;
-
-   if (IRC_SVR.sa4.sin_addr.s_addr == INADDR_NONE)
-   {
-      log_printf("IRC -> Unknown error resolving remote host (%s)",
-          IRCItem->server);
-      exit(EXIT_FAILURE);
-   }
-
-   /* Request file desc for IRC client socket */
-   IRC_FD = socket(AF_INET, SOCK_STREAM, 0);
-
-   if (IRC_FD == -1)
-   {
-      switch(errno)
-      {
-         case EINVAL:
-         case EPROTONOSUPPORT:
-            log_printf("IRC -> socket(): SOCK_STREAM is not "
-                "supported on this domain");
-            break;
-         case ENFILE:
-            log_printf("IRC -> socket(): Not enough free file "
-                "descriptors to allocate IRC socket");
-            break;
-         case EMFILE:
-            log_printf("IRC -> socket(): Process table overflow when "
-                "requesting file descriptor");
-            break;
-         case EACCES:
-            log_printf("IRC -> socket(): Permission denied to create "
-                "socket of type SOCK_STREAM");
-            break;
-         case ENOMEM:
-            log_printf("IRC -> socket(): Insufficient memory to "
-                "allocate socket");
-            break;
-         default:
-            log_printf("IRC -> socket(): Unknown error allocating "
-                "socket");
-            break;
-      }
-      exit(EXIT_FAILURE);
-   }
-
-   /* Bind */
-   if (strlen(IRCItem->vhost) > 0)
-   {
-      int bindret = 0;
-      if (!inet_pton(AF_INET, IRCItem->vhost, &(IRC_LOCAL.in4.s_addr)))
-      {
-         log_printf("IRC -> bind(): %s is an invalid address", IRCItem->vhost);
-         exit(EXIT_FAILURE);
-      }
-      bsaddr.sa4.sin_addr.s_addr = IRC_LOCAL.in4.s_addr;
-      bsaddr.sa4.sin_family = AF_INET;
-      bsaddr.sa4.sin_port = htons(0);
-
-      bindret = bind(IRC_FD, (struct sockaddr *) &(bsaddr.sa4), sizeof(bsaddr.sa4));
-
-      if (bindret)
-      {
-         switch(errno)
-         {
-            case EACCES:
-               log_printf("IRC -> bind(): No access to bind to %s",
-                   IRCItem->vhost);
-               break;
-            default:
-               log_printf("IRC -> bind(): Error binding to %s (%d)",
-                   IRCItem->vhost, errno);
-               break;
-         }
-         exit(EXIT_FAILURE);
-      }
-
-   }
-
-   /* Setup target list for irc_send_channels */
-   IRC_CHANNELS[0] = '\0';
-   LIST_FOREACH(node, IRCItem->channels->head)
-   {
-      chan = (struct ChannelConf *) node->data;
-      strncat(IRC_CHANNELS, chan->name, MSGLENMAX);
-
-      if(node->next)
-         strncat(IRC_CHANNELS, ",", MSGLENMAX);
-   }
-   IRC_CHANNELS[MSGLENMAX] = '\0';
-
-
-}
-
-
-/* irc_send
- *
- *    Send data to remote IRC host.
- *
- * Parameters:
- *    data: Format of data to send
- *    ...: varargs to format with
- * 
- * Return: NONE
- */
-
-
-void irc_send(char *data, ...)
-{
-   va_list arglist;
-   char    data2[MSGLENMAX];
-   char    tosend[MSGLENMAX];
-
-   va_start(arglist, data);
-   vsnprintf(data2, MSGLENMAX, data, arglist);
-   va_end(arglist);
-
-   if (OPT_DEBUG >= 2)
-      log_printf("IRC SEND -> %s", data2);
-
-   snprintf(tosend, MSGLENMAX, "%s\n", data2);
-
-   if (send(IRC_FD, tosend, strlen(tosend), 0) == -1)
-   {
-      /* Return of -1 indicates error sending data; we reconnect. */
-      log_printf("IRC -> Error sending data to server\n");
-      irc_reconnect();
-   }
-}
-
-/* irc_send
- *
- *    Send privmsg to all channels.
- *
- * Parameters:
- *    data: Format of data to send
- *    ...: varargs to format with
- *
- * Return: NONE
- */
-
-void irc_send_channels(char *data, ...)
-{
-   va_list arglist;
-   char    data2[MSGLENMAX];
-   char    tosend[MSGLENMAX];
-
-   va_start(arglist, data);
-   vsnprintf(data2, MSGLENMAX, data, arglist);
-   va_end(arglist);
-
-   snprintf(tosend, MSGLENMAX, "PRIVMSG %s :%s", IRC_CHANNELS, data2);
-
-   irc_send("%s", tosend);
-}
-
-
-
-
-/* irc_connect
- *
- *    Connect to IRC server.
- *    XXX: FD allocation done here
- *
- * Parameters: NONE
- * Return: NONE
- *
- */
-
-static void irc_connect(void)
-{
-   /* Connect to IRC server as client. */
-   if (connect(IRC_FD, (struct sockaddr *) &IRC_SVR,
-               sizeof(IRC_SVR)) == -1)
-   {
-      switch(errno)
-      {
-         case EISCONN:
-            /* Already connected */
-            return;
-         case ECONNREFUSED:
-            log_printf("IRC -> connect(): Connection refused by (%s)",
-                IRCItem->server);
-            break;
-         case ETIMEDOUT:
-            log_printf("IRC -> connect(): Timed out connecting to (%s)",
-                IRCItem->server);
-            break;
-         case ENETUNREACH:
-            log_printf("IRC -> connect(): Network unreachable");
-            break;
-         case EALREADY:
-            /* Previous attempt not complete */
-            return;
-         default:
-            log_printf("IRC -> connect(): Unknown error connecting to (%s)",
-                IRCItem->server);
-
-            if (OPT_DEBUG >= 1)
-               log_printf("%s", strerror(errno));
-      }
-      /* Try to connect again */
-      irc_reconnect();
-      return;
-   }
-
-   irc_send("NICK %s", IRCItem->nick);
-
-   if(strlen(IRCItem->password) > 0)
-      irc_send("PASS %s", IRCItem->password);
-
-   irc_send("USER %s %s %s :%s",
-            IRCItem->username, IRCItem->username, IRCItem->username,
-            IRCItem->realname);
-
-   time(&IRC_LAST);
-}
-
-
-/* irc_reconnect
- *
- *    Close connection to IRC server.
- *
- * Parameters: NONE
- *
- * Return: NONE
- */
-
-static void irc_reconnect(void)
-{
-
-   time_t present;
-   
-   time(&present);
-  
-   /* Only try to reconnect every RECONNECT_INTERVAL seconds */ 
-   if((present - IRC_LASTRECONNECT) < RECONNECTINTERVAL)
-   {
-      /* Sleep to avoid excessive CPU */
-      sleep(1);
-      return;
-   }
-
-   time(&IRC_LASTRECONNECT);
-
-   if(IRC_FD > 0)
-      close(IRC_FD);
-
-   /* Set IRC_FD 0 for reconnection on next irc_cycle(). */
-   IRC_FD = 0;
-
-   log_printf("IRC -> Connection to (%s) failed, reconnecting.", IRCItem->server);
-}
-
-
-
-/* irc_read
- *
- *    irc_read is called my irc_cycle when new data is ready to be
- *    read from the irc server. 
- *
- * Parameters: NONE
- * Return: NONE
- *
- */
-
-static void irc_read(void)
-{
-   int len;
-   char c;
-
-   while ((len = read(IRC_FD, &c, 1)) > 0)
-   {
-      if (c == '\r')
-         continue;
-
-      if (c == '\n')
-      {
-         /* Null string. */
-         IRC_RAW[IRC_RAW_LEN] = '\0';
-         /* Parse line. */
-         irc_parse();
-         /* Reset counter. */
-         IRC_RAW_LEN = 0;
-         break;
-      }
-
-      if (c != '\r' && c != '\n' && c != '\0')
-         IRC_RAW[IRC_RAW_LEN++] = c;
-   }
-
-   if((len <= 0) && (errno != EAGAIN))
-   {
-      if(OPT_DEBUG >= 2)
-         log_printf("irc_read -> errno=%d len=%d", errno, len);
-      irc_reconnect();
-      IRC_RAW_LEN = 0;
-      return;
-   }
-}
-
-
-/* irc_parse
- *
- *    irc_parse is called by irc_read when a full line of data
- *    is ready to be parsed.
- *
- * Parameters: NONE
- * Return: NONE
- *
- */
-
-
-static void irc_parse(void)
-{
-   struct UserInfo *source_p;
-   char *pos;
-   unsigned int i;
-
-   /*
-      parv stores the parsed token, parc is the count of the parsed 
-      tokens
-     
-      parv[0] is ALWAYS the source, and is the server name of the source
-      did not exist 
-   */
-
-   static char            *parv[17];
-   static unsigned int     parc;
-   static char             msg[MSGLENMAX];    /* Temporarily stores IRC msg to pass to handlers */
-
-   parc = 1;
-
-   if(IRC_RAW_LEN <= 0)
-      return;
-
-   if (OPT_DEBUG >= 2)
-      log_printf("IRC READ -> %s", IRC_RAW);
-
-   time(&IRC_LAST);
-
-   /* Store a copy of IRC_RAW for the handlers (for functions that need PROOF) */
-   strcpy(msg, IRC_RAW);
-
-   /* parv[0] is always the source */
-   if(IRC_RAW[0] == ':')
-      parv[0] = IRC_RAW + 1;
-   else
-   {
-      parv[0] = IRCItem->server;
-      parv[parc++] = IRC_RAW;
-   }
-
-   pos = IRC_RAW;
-
-   while((pos = strchr(pos, ' ')) && parc <= 17)
-   {
-
-      /* Avoid excessive spaces and end of IRC_RAW */
-      if(*(pos + 1) == ' ' && *(pos + 1) == '\0')
-      {
-         pos++;
-         continue;
-      }
-
-      /* Anything after a : is considered the final string of the
-            message */
-      if(*(pos + 1) == ':')
-      {
-         parv[parc++] = pos + 2;
-         *pos = '\0';
-         break;
-      }
-
-      /* Set the next parv at this position and replace the space with a
-         \0 for the previous parv */
-      parv[parc++] = pos + 1;
-      *pos = '\0';
-      pos++;
-   }
-
-   /* Generate a UserInfo struct from the source */
-
-   source_p = userinfo_create(parv[0]);
-
-   /* Determine which command this is from the command table
-      and let the handler for that command take control */
-
-   for(i = 0; i < (sizeof(COMMAND_TABLE) / sizeof(struct CommandHash)); i++)
-      if(strcasecmp(COMMAND_TABLE[i].command, parv[1]) == 0)
-      {
-         (*COMMAND_TABLE[i].handler)(parv, parc, msg, source_p);
-         break;
-      }
-
-   userinfo_free(source_p);
-}
-
-
-
-
-/* irc_timer
- *
- *    Functions to be performed every ~seconds.
- *
- * Parameters: NONE
- * Return: NONE
- *
- */
-
-void irc_timer(void)
-{
-   time_t present, delta;
-
-   time(&present);
-
-   delta = present - IRC_LAST;
-
-   /* No data in NODATA_TIMEOUT minutes (set in options.h). */
-   if (delta >= NODATA_TIMEOUT)
-   {
-      log_printf("IRC -> Timeout awaiting data from server.");
-      irc_reconnect();
-      /* Make sure we dont do this again for a while */
-      time(&IRC_LAST);
-   }
-   else if (delta >= NODATA_TIMEOUT / 2)
-   {
-      /*
-       * Generate some data so high ping times or bugs in certain
-       * ircds (*cough* unreal *cough*) don't cause uneeded
-       * reconnections
-       */
-      irc_send("PING :BOPM");
-   }
-
-}
-
-
-
-
-/* get_channel
- *
- *    Check if a channel is defined in our conf. If so return
- *    a pointer to it.
- *
- * Parameters:
- *    channel: channel to search conf for
- *
- * Return: Pointer to ChannelConf containing the channel
- */
-
-static struct ChannelConf *get_channel(const char *channel)
-{
-   node_t *node;
-   struct ChannelConf *item;
+#include "main.h"
+#include "serno.h"
 
-   LIST_FOREACH(node, IRCItem->channels->head)
-   {
-      item = node->data;
 
-      if(strcasecmp(item->name, channel) == 0)
-         return item;
-   }
+enum { IRC_BUFSIZE = 65536 };  /* Bytes of server input buffered at once */
+enum { IRC_SENDQ_SIZE = 65536 };  /* Bytes of output queued while the server lags */
+enum { IRC_ADDR_MAX = 2 };  /* Addresses of the IRC server kept, one IPv6 and one IPv4 */
+enum { IRC_CONNECT_TIMEOUT = 30 };  /* Seconds a connect() may take */
+enum { IRC_BACKOFF_MAX = 4 };  /* Doublings of reconnectinterval after failed attempts */
 
-   return NULL;
-}
+enum irc_state
+{
+  IRC_DISCONNECTED,  /* Waiting for IRC_NEXTCONNECT */
+  IRC_RESOLVING,     /* Waiting for the addresses of the IRC server */
+  IRC_CONNECTING,    /* Waiting for a non-blocking connect() */
+  IRC_CONNECTED
+};
 
-=======
-static char         IRC_RAW[MSGLENMAX];  /* Buffer to read data into               */
-static unsigned int IRC_RAW_LEN;         /* Position of IRC_RAW                    */
-static int          IRC_FD = -1;         /* File descriptor for IRC client         */
+/*
+ * Certain variables we don't want to allocate memory for over and over
+ * again so global scope is given.
+ */
+static char         IRC_RAW[IRC_BUFSIZE];  /* Buffer to read data into           */
+static size_t       IRC_RAW_LEN;           /* Bytes of IRC_RAW in use            */
+static char         IRC_SENDQ[IRC_SENDQ_SIZE];  /* Output the socket did not take yet */
+static size_t       IRC_SENDQ_LEN;         /* Bytes of IRC_SENDQ in use          */
+static int          IRC_FD = -1;           /* File descriptor for IRC client     */
+
+static enum irc_state IRC_STATE = IRC_DISCONNECTED;
+
+static struct sockaddr_storage IRC_SVR[IRC_ADDR_MAX];  /* Addresses of the IRC server, IPv6 first */
+static socklen_t IRC_SVR_LEN[IRC_ADDR_MAX];
+static unsigned int IRC_SVR_COUNT;        /* Addresses in IRC_SVR, 0 to resolve again   */
+static unsigned int IRC_SVR_NEXT;         /* Address in IRC_SVR to connect to next      */
+static time_t IRC_SVR_EXPIRES;            /* When IRC_SVR is stale, 0 for never         */
+static unsigned int IRC_RESOLVE_PENDING;  /* Queries for the server name not answered   */
+static int IRC_RESOLVE_ERROR;             /* firedns_errno of the last failed query     */
 
-static struct sockaddr_storage IRC_SVR;  /* Sock Address Struct for IRC server     */
-static socklen_t svr_addrlen;
 static time_t IRC_LAST;                  /* Last full line of data from irc server */
-static time_t IRC_LASTRECONNECT;         /* Time of last reconnection              */
+static time_t IRC_LASTCONNECT;           /* Start of the last connection attempt   */
+static time_t IRC_NEXTCONNECT;           /* Earliest time of the next attempt      */
+static time_t IRC_CONNECTSTART;          /* Start of the pending connect()         */
+static unsigned int IRC_FAILURES;        /* Attempts since we were last registered */
 
 
 /* get_channel
@@ -797,6 +140,9 @@ m_perform(char *parv[], unsigned int parc, const char *msg, const char *source_p
 
   log_printf("IRC -> Connected to %s/%d", IRCItem->server, IRCItem->port);
 
+  /* Registered; the next reconnect starts without backoff */
+  IRC_FAILURES = 0;
+
   /* Identify to nickserv if needed */
   if (!EmptyString(IRCItem->nickserv))
     irc_send("%s", IRCItem->nickserv);
@@ -1092,462 +438,17 @@ m_kill(char *parv[], unsigned int parc, const char *msg, const char *source_p)
   /* Restart hopm to rehash */
   main_restart();
 }
->>>>>>> remotes/new/master
 
 /* userinfo_create
  *
  *    Parse a nick!user@host into a UserInfo struct
- *    and return a pointer to the new struct.
- *
- * Parameters:
- *    source: nick!user@host to parse
- *
- * Return:
- *    pointer to new UserInfo struct, or NULL if parsing failed
-<<<<<<< HEAD
- *
- */
-
-static struct UserInfo *userinfo_create(char *source)
-{
-   struct UserInfo *ret;
-
-   char *nick;
-   char *username;
-   char *hostname;
-   char *tmp;
-
-   int i, len;
-
-   nick = username = hostname = NULL;
-   tmp = DupString(source);
-   len = strlen(tmp);
-
-   nick = tmp;
-
-   for(i = 0; i < len; i++)
-   {
-      if(tmp[i] == '!')
-      {
-         tmp[i] = '\0';
-         username = tmp + i + 1;
-      }
-      if(tmp[i] == '@')
-      {
-         tmp[i] = '\0';
-         hostname = tmp + i + 1;
-      }
-   }
-
-   if(nick == NULL || username == NULL || hostname == NULL)
-   {
-      MyFree(tmp);
-      return NULL;
-   }
-
-   ret = MyMalloc(sizeof *ret);
-
-   ret->irc_nick     = DupString(nick);
-   ret->irc_username = DupString(username);
-   ret->irc_hostname = DupString(hostname);
-
-   MyFree(tmp);
-
-   return ret;
-};
-
-
-
-/* userinfo_free
- *
- *    Free a UserInfo struct created with userinfo_create.
- *
- * Parameters:
- *    source: struct to free
- * 
- * Return: None
- *
- */
-
-static void userinfo_free(struct UserInfo *source_p)
-{
-   if(source_p == NULL)
-      return;
-
-   MyFree(source_p->irc_nick);
-   MyFree(source_p->irc_username);
-   MyFree(source_p->irc_hostname);
-   MyFree(source_p);
-}
-
-
-
-/* m_perform
- *
- *    actions to perform on IRC connection
- *
- * Parameters:
- * parv[0]  = source
- * parv[1]  = PING
- * parv[2]  = PING TS/Package
- *
- * source_p: UserInfo struct of the source user, or NULL if
- * the source (parv[0]) is a server.
- */
-
-static void m_perform(char **parv, unsigned int parc, char *msg, struct UserInfo *notused)
-{
-   node_t *node;
-   struct ChannelConf *channel;
-
-   USE_VAR(parv);
-   USE_VAR(parc);
-   USE_VAR(msg);
-   USE_VAR(notused);
-
-   log_printf("IRC -> Connected to %s:%d", IRCItem->server, IRCItem->port);
-
-   /* Identify to nickserv if needed */
-   if(strlen(IRCItem->nickserv))
-      irc_send("%s", IRCItem->nickserv);
-
-   /* Oper */
-   irc_send("OPER %s", IRCItem->oper);
-
-   /* Set modes */
-   irc_send("MODE %s %s", IRCItem->nick, IRCItem->mode);
-
-   /* Set Away */
-   irc_send("AWAY :%s", IRCItem->away);
-
-   /* Perform */
-   LIST_FOREACH(node, IRCItem->performs->head)
-      irc_send("%s", (char *) node->data);
-
-   /* Join all listed channels. */
-   LIST_FOREACH(node, IRCItem->channels->head)
-   {
-      channel = (struct ChannelConf *) node->data;
-
-      if(strlen(channel->name) == 0)
-         continue;
-
-      if(strlen(channel->key) > 0)
-         irc_send("JOIN %s %s", channel->name, channel->key);
-      else
-         irc_send("JOIN %s", channel->name);
-   }
-}
-
-
-/* m_ping
- *
- * parv[0]  = source
- * parv[1]  = PING
- * parv[2]  = PING TS/Package
- *
- * source_p: UserInfo struct of the source user, or NULL if
- * the source (parv[0]) is a server.
- */
-static void m_ping(char **parv, unsigned int parc, char *msg, struct UserInfo *source_p)
-{
-   USE_VAR(msg);
-   USE_VAR(source_p);
-
-   if(parc < 3)
-      return;
-
-   if(OPT_DEBUG >= 2)
-      log_printf("IRC -> PING? PONG!");
-
-   irc_send("PONG %s", parv[2]);
-}
-
-
-
-/* m_invite
- *
- * parv[0]  = source
- * parv[1]  = INVITE
- * parv[2]  = target
- * parv[3]  = channel
- *
- * source_p: UserInfo struct of the source user, or NULL if
- * the source (parv[0]) is a server.
- *
- */
-
-static void m_invite(char **parv, unsigned int parc, char *msg, struct UserInfo *source_p)
-{
-   struct ChannelConf *channel;
-   
-   USE_VAR(msg);
-   USE_VAR(source_p);
-
-   if(parc < 4)
-      return;
-
-   log_printf("IRC -> Invited to %s by %s", parv[3], parv[0]);
-
-   if((channel = get_channel(parv[3])) == NULL)
-      return;
-
-   irc_send("JOIN %s %s", channel->name, channel->key);
-}
-
-
-
-
-/* m_privmsg
- *
- * parv[0]  = source
- * parv[1]  = PRIVMSG
- * parv[2]  = target (channel or user)
- * parv[3]  = message
- *
- * source_p: UserInfo struct of the source user, or NULL if
- * the source (parv[0]) is a server.
- *
- */
-
-static void m_privmsg(char **parv, unsigned int parc, char *msg, struct UserInfo *source_p)
-{
-   struct ChannelConf *channel;
-   size_t nick_len;
-
-   if(source_p == NULL)
-      return;
-
-   if(parc < 4)
-      return;
-
-   /* CTCP */
-   if(parv[3][0] == '\001')
-      m_ctcp(parv, parc, msg, source_p);
-
-   /* Only interested in privmsg to channels */
-   if(parv[2][0] != '#' && parv[2][0] != '&')
-      return;
-
-   /* Get a target */
-   if((channel = get_channel(parv[2])) == NULL)
-      return;
-
-   /* Find a suitable length to compare with */
-   nick_len = strcspn(parv[3], " :,");
-   if(nick_len < 3 && strlen(IRCItem->nick) >= 3)
-      nick_len = 3;
-   
-   /* message is a command */
-   if(strncasecmp(parv[3], IRCItem->nick, nick_len) == 0  ||
-         strncasecmp(parv[3], "!all", 4) == 0)
-   {
-      /* XXX command_parse will alter parv[3]. */
-      command_parse(parv[3], msg, channel, source_p);
-   }
-}
-
-
-
-
-
-/* m_ctcp
- * parv[0]  = source
- * parv[1]  = PRIVMSG
- * parv[2]  = target (channel or user)
- * parv[3]  = message
- *
- * source_p: UserInfo struct of the source user, or NULL if
- * the source (parv[0]) is a server.
- *
- */
-
-static void m_ctcp(char **parv, unsigned int parc, char *msg, struct UserInfo *source_p)
-{
-   USE_VAR(parc);
-   USE_VAR(msg);
-
-   if(strncasecmp(parv[3], "\001VERSION\001", 9) == 0)
-   {
-      irc_send("NOTICE %s :\001VERSION Blitzed Open Proxy Monitor %s\001",
-            source_p->irc_nick, VERSION);
-   }
-}
-
-
-
-
-
-/* m_notice
- *
- * parv[0]  = source
- * parv[1]  = NOTICE
- * parv[2]  = target
- * parv[3]  = message
- *
- *
- * source_p: UserInfo struct of the source user, or NULL if
- * the source (parv[0]) is a server.
- *
- */
-
-static void m_notice(char **parv, unsigned int parc, char *msg, struct UserInfo *source_p)
-{
-
-
-   static regex_t *preg = NULL;
-   regmatch_t pmatch[5];
-
-   static char errmsg[256];
-   int errnum, i;
-
-   char *user[4];
-
-   if(parc < 4)
-      return;
-
-   /* Not interested in notices from users */
-   if(source_p != NULL)
-      return;
-
-   /* Compile the regular expression if it has not been already */
-   if(preg == NULL)
-   {
-      preg = MyMalloc(sizeof *preg);
-
-      if((errnum = regcomp(preg, IRCItem->connregex, REG_ICASE | REG_EXTENDED)) != 0)
-      {
-
-         regerror(errnum, preg, errmsg, 256);
-         log_printf("IRC REGEX -> Error when compiling regular expression");
-         log_printf("IRC REGEX -> %s", errmsg);
-
-         MyFree(preg);
-         preg = NULL;
-         return;
-      }
-   }
-
-   /* Match the expression against the possible connection notice */
-   if(regexec(preg, parv[3], 5, pmatch, 0) != 0)
-      return;
-
-   if(OPT_DEBUG > 0)
-      log_printf("IRC REGEX -> Regular expression caught connection notice. Parsing.");
-
-   if(pmatch[4].rm_so == -1)
-   {
-      log_printf("IRC REGEX -> pmatch[4].rm_so is -1 while parsing??? Aborting.");
-      return;
-   }
-
-   /*
-       Offsets for data in the connection notice:
-
-       NICKNAME: pmatch[1].rm_so  TO  pmatch[1].rm_eo 
-       USERNAME: pmatch[2].rm_so  TO  pmatch[2].rm_eo
-       HOSTNAME: pmatch[3].rm_so  TO  pmatch[3].rm_eo
-       IP      : pmatch[4].rm_so  TO  pmatch[4].rm_eo
-
-    */ 
-
-   for(i = 0; i < 4; i++)
-   {
-      user[i] = (parv[3] + pmatch[i + 1].rm_so);
-      *(parv[3] + pmatch[i + 1].rm_eo) = '\0';
-   }
-
-   if(OPT_DEBUG > 0)
-      log_printf("IRC REGEX -> Parsed %s!%s@%s [%s] from connection notice.",
-          user[0], user[1], user[2], user[3]);
-
-   /*FIXME (reminder) In the case of any rehash to the regex, preg MUST be freed first.
-       regfree(preg);
-   */
-
-   /* Pass this information off to scan.c */
-   scan_connect(user, msg);
-   /* Record the connect for stats purposes */
-   stats_connect();
-}
-
-/* m_userhost
- *
- * parv[0]  = source
- * parv[1]  = USERHOST
- * parv[2]  = target (bopm)
- * parv[3]  = :nick=(flags)user@host
- *
- *
- * source_p: UserInfo struct of the source user, or NULL if
- * the source (parv[0]) is a server.
- *
- */
-
-static void m_userhost(char **parv, unsigned int parc, char *msg,
-      struct UserInfo *source_p)
-{
-   USE_VAR(msg);
-   USE_VAR(source_p);
-
-   if(parc < 4)
-      return;
-
-   command_userhost(parv[3]);
-}
-
-/* m_cannot_join
- *
- * parv[0]  = source
- * parv[1]  = numeric
- * parv[2]  = target (bopm)
- * parv[3]  = channel
- * parv[4]  = error text
- *
- */
-
-static void m_cannot_join(char **parv, unsigned int parc, char *msg,
-      struct UserInfo *source_p)
-{
-   struct ChannelConf *channel;
-
-   USE_VAR(msg);
-   USE_VAR(source_p);
-
-   if(parc < 5)
-      return;
-
-   /* Is it one of our channels? */
-   if((channel = get_channel(parv[3])) == NULL)
-      return;
-
-   if(strlen(channel->invite) == 0)
-      return;
-
-   irc_send("%s", channel->invite);
-}
-
-
-/* m_kill
- *
- * parv[0]  = source
- * parv[1]  = numeric
- * parv[2]  = target (bopm)
- * parv[3]  = channel
- * parv[4]  = error text
+ *    and return a pointer to the new struct.
  *
- */
-
-static void m_kill(char **parv, unsigned int parc, char *msg, struct UserInfo *source_p)
-{
-   USE_VAR(parv);
-   USE_VAR(parc);
-   USE_VAR(msg);
-   USE_VAR(source_p);
-
-   /* Restart bopm to rehash */
-   main_restart();
-=======
+ * Parameters:
+ *    source: nick!user@host to parse
+ *
+ * Return:
+ *    pointer to new UserInfo struct, or NULL if parsing failed
  */
 static const char *
 userinfo_create(const char *source)
@@ -1579,64 +480,120 @@ userinfo_create(const char *source)
   return NULL;
 };
 
-/* irc_init
+/* irc_svr_add
  *
- *    Resolve IRC host and perform other initialization.
+ *    Add an address of the IRC server to IRC_SVR. IPv6 addresses go
+ *    first, so they are tried before IPv4 ones.
  *
  * Parameters:
- *    None
+ *    family: AF_INET or AF_INET6
+ *    address: struct in_addr or struct in6_addr
  *
- * Return:
- *    None
+ * Return: NONE
  */
 static void
-irc_init(void)
+irc_svr_add(int family, const void *address)
 {
-  const void *address = NULL;
+  struct sockaddr_storage svr;
+  socklen_t len;
 
-  assert(IRC_FD == -1);
+  if (IRC_SVR_COUNT == IRC_ADDR_MAX)
+    return;
 
-  memset(&IRC_SVR, 0, sizeof(IRC_SVR));
+  memset(&svr, 0, sizeof(svr));
 
-  /* Resolve IRC host. */
-  if ((address = firedns_resolveip6(IRCItem->server)))
+  if (family == AF_INET6)
   {
-    struct sockaddr_in6 *in = (struct sockaddr_in6 *)&IRC_SVR;
+    struct sockaddr_in6 *in = (struct sockaddr_in6 *)&svr;
 
-    svr_addrlen = sizeof(*in);
-    IRC_SVR.ss_family = AF_INET6;
+    len = sizeof(*in);
+    in->sin6_family = AF_INET6;
     in->sin6_port = htons(IRCItem->port);
     memcpy(&in->sin6_addr, address, sizeof(in->sin6_addr));
+
+    memmove(&IRC_SVR[1], &IRC_SVR[0], sizeof(IRC_SVR[0]) * IRC_SVR_COUNT);
+    memmove(&IRC_SVR_LEN[1], &IRC_SVR_LEN[0], sizeof(IRC_SVR_LEN[0]) * IRC_SVR_COUNT);
+    IRC_SVR[0] = svr;
+    IRC_SVR_LEN[0] = len;
   }
-  else if ((address = firedns_resolveip4(IRCItem->server)))
+  else
   {
-    struct sockaddr_in *in = (struct sockaddr_in *)&IRC_SVR;
+    struct sockaddr_in *in = (struct sockaddr_in *)&svr;
 
-    svr_addrlen = sizeof(*in);
-    IRC_SVR.ss_family = AF_INET;
+    len = sizeof(*in);
+    in->sin_family = AF_INET;
     in->sin_port = htons(IRCItem->port);
     memcpy(&in->sin_addr, address, sizeof(in->sin_addr));
+
+    IRC_SVR[IRC_SVR_COUNT] = svr;
+    IRC_SVR_LEN[IRC_SVR_COUNT] = len;
   }
-  else
-  {
-    log_printf("IRC -> firedns_resolveip(\"%s\"): %s", IRCItem->server,
-               firedns_strerror(firedns_errno));
-    exit(EXIT_FAILURE);
-  }
 
-  /* Request file desc for IRC client socket */
-  IRC_FD = socket(IRC_SVR.ss_family, SOCK_STREAM, 0);
+  ++IRC_SVR_COUNT;
+}
+
+/* irc_reconnect
+ *
+ *    Close connection to IRC server and schedule the next attempt.
+ *    Attempts are at least IRCItem->reconnectinterval seconds apart;
+ *    the interval doubles with every attempt that does not get us
+ *    registered, up to 2^IRC_BACKOFF_MAX times.
+ *
+ * Parameters: NONE
+ *
+ * Return: NONE
+ */
+static void
+irc_reconnect(void)
+{
+  time_t delay = IRCItem->reconnectinterval;
+
+  if (IRC_STATE == IRC_DISCONNECTED)
+    return;  /* Already waiting for the next attempt */
 
-  if (IRC_FD == -1)
+  if (IRC_FD > -1)
   {
-    log_printf("IRC -> socket(): error creating socket: %s", strerror(errno));
-    exit(EXIT_FAILURE);
+    close(IRC_FD);
+    IRC_FD = -1;
   }
 
-  /* Bind */
+  /* Nothing buffered for this connection may spill into the next one */
+  IRC_RAW_LEN = 0;
+  IRC_SENDQ_LEN = 0;
+
+  IRC_STATE = IRC_DISCONNECTED;
+
+  delay <<= IRC_FAILURES < IRC_BACKOFF_MAX ? IRC_FAILURES : IRC_BACKOFF_MAX;
+  ++IRC_FAILURES;
+
+  IRC_NEXTCONNECT = IRC_LASTCONNECT + delay;
+
+  log_printf("IRC -> Connection to (%s) failed, reconnecting in %lu seconds.", IRCItem->server,
+             (unsigned long)(IRC_NEXTCONNECT > time(NULL) ? IRC_NEXTCONNECT - time(NULL) : 0));
+}
+
+/* irc_connect
+ *
+ *    Start a non-blocking connect to the next address in IRC_SVR.
+ *    With a vhost, only addresses of its family are tried. Once all of
+ *    them failed, they are resolved again on the next attempt.
+ *    XXX: FD allocation done here
+ *
+ * Parameters: NONE
+ * Return: NONE
+ */
+static void
+irc_connect(void)
+{
+  struct addrinfo *vhost = NULL;
+  const unsigned int first = IRC_SVR_NEXT;
+  unsigned int tried = 0;
+
+  IRC_STATE = IRC_CONNECTING;
+
   if (!EmptyString(IRCItem->vhost))
   {
-    struct addrinfo hints, *res;
+    struct addrinfo hints;
     int n;
 
     memset(&hints, 0, sizeof(hints));
@@ -1645,91 +602,189 @@ irc_init(void)
     hints.ai_socktype = SOCK_STREAM;
     hints.ai_flags = AI_NUMERICHOST;
 
-    if ((n = getaddrinfo(IRCItem->vhost, NULL, &hints, &res)))
+    /* Not an address at all; no point in ever trying again */
+    if ((n = getaddrinfo(IRCItem->vhost, NULL, &hints, &vhost)))
     {
       log_printf("IRC -> error binding to %s: %s", IRCItem->vhost, gai_strerror(n));
       exit(EXIT_FAILURE);
     }
-    else if (bind(IRC_FD, res->ai_addr, res->ai_addrlen))
+  }
+
+  while (IRC_SVR_NEXT < IRC_SVR_COUNT)
+  {
+    const unsigned int i = IRC_SVR_NEXT++;
+
+    /* A socket bound to the vhost cannot reach the other family */
+    if (vhost && vhost->ai_family != IRC_SVR[i].ss_family)
+      continue;
+
+    ++tried;
+
+    /* Request file desc for IRC client socket */
+    if ((IRC_FD = socket(IRC_SVR[i].ss_family, SOCK_STREAM, 0)) == -1)
+    {
+      log_printf("IRC -> socket(): error creating socket: %s", strerror(errno));
+      continue;
+    }
+
+    /* Bind */
+    if (vhost && bind(IRC_FD, vhost->ai_addr, vhost->ai_addrlen))
     {
       log_printf("IRC -> error binding to %s: %s", IRCItem->vhost, strerror(errno));
-      exit(EXIT_FAILURE);
+
+      close(IRC_FD);
+      IRC_FD = -1;
+      continue;
+    }
+
+    /* Connect to IRC server as client; irc_event() learns how it went */
+    if (fcntl(IRC_FD, F_SETFL, O_NONBLOCK) == 0 &&
+        (connect(IRC_FD, (struct sockaddr *)&IRC_SVR[i], IRC_SVR_LEN[i]) == 0 || errno == EINPROGRESS))
+    {
+      time(&IRC_CONNECTSTART);
+      break;
     }
 
-    freeaddrinfo(res);
+    log_printf("IRC -> connect(): error connecting to %s: %s",
+               IRCItem->server, strerror(errno));
+
+    close(IRC_FD);
+    IRC_FD = -1;
+  }
+
+  if (vhost)
+  {
+    if (first == 0 && tried == 0)
+      log_printf("IRC -> %s has no address of the same family as vhost %s",
+                 IRCItem->server, IRCItem->vhost);
+
+    freeaddrinfo(vhost);
   }
+
+  if (IRC_FD > -1)
+    return;  /* Connecting */
+
+  /* Resolve again next time, the server may have moved */
+  IRC_SVR_COUNT = 0;
+
+  /* Try to connect again */
+  irc_reconnect();
 }
 
-/* irc_reconnect
+/* irc_connected
  *
- *    Close connection to IRC server.
+ *    The connect started by irc_connect() finished; register with the
+ *    server.
  *
  * Parameters: NONE
- *
  * Return: NONE
  */
 static void
-irc_reconnect(void)
+irc_connected(void)
 {
-  time_t present;
+  IRC_STATE = IRC_CONNECTED;
 
-  time(&present);
+  irc_send("NICK %s", IRCItem->nick);
+
+  if (!EmptyString(IRCItem->password))
+    irc_send("PASS %s", IRCItem->password);
+
+  irc_send("USER %s %s %s :%s",
+           IRCItem->username,
+           IRCItem->username,
+           IRCItem->username,
+           IRCItem->realname);
+  time(&IRC_LAST);
+}
 
-  /* Only try to reconnect every IRCItem->reconnectinterval seconds */
-  if ((present - IRC_LASTRECONNECT) < IRCItem->reconnectinterval)
+/* irc_resolved
+ *
+ *    Callback for the A and AAAA queries of irc_resolve(). Once both
+ *    are done, the addresses found are cached for the lowest TTL among
+ *    them and connecting starts.
+ *
+ * Parameters:
+ *    res: Result of the query
+ *
+ * Return: NONE
+ */
+static void
+irc_resolved(struct firedns_result *res)
+{
+  if (firedns_errno == FDNS_ERR_NONE)
   {
-    /* Sleep to avoid excessive CPU */
-    sleep(1);
-    return;
+    irc_svr_add(res->type == FDNS_QRY_AAAA ? AF_INET6 : AF_INET, res->text);
+
+    if (IRC_SVR_EXPIRES == 0 || time(NULL) + (time_t)res->ttl < IRC_SVR_EXPIRES)
+      IRC_SVR_EXPIRES = time(NULL) + res->ttl;
   }
+  else
+    IRC_RESOLVE_ERROR = firedns_errno;
 
-  time(&IRC_LASTRECONNECT);
+  if (--IRC_RESOLVE_PENDING)
+    return;
 
-  if (IRC_FD > -1)
+  if (IRC_SVR_COUNT == 0)
   {
-    close(IRC_FD);
-    IRC_FD = -1;  /* Set IRC_FD -1 for reconnection on next irc_cycle(). */
+    log_printf("IRC -> firedns_getip(\"%s\"): %s", IRCItem->server,
+               firedns_strerror(IRC_RESOLVE_ERROR));
+    irc_reconnect();
+    return;
   }
 
-  log_printf("IRC -> Connection to (%s) failed, reconnecting.", IRCItem->server);
+  irc_connect();
 }
 
-/* irc_connect
+/* irc_resolve
  *
- *    Connect to IRC server.
- *    XXX: FD allocation done here
+ *    Look up the addresses of the IRC server. Literal addresses are
+ *    used as they are, host names go through the resolver without
+ *    blocking.
  *
  * Parameters: NONE
  * Return: NONE
  */
 static void
-irc_connect(void)
+irc_resolve(void)
 {
-  /* Connect to IRC server as client. */
-  if (connect(IRC_FD, (struct sockaddr *)&IRC_SVR, svr_addrlen) == -1)
-  {
-    log_printf("IRC -> connect(): error connecting to %s: %s",
-               IRCItem->server, strerror(errno));
+  struct in6_addr addr6;
+  struct in_addr addr4;
 
-    if (errno == EISCONN /* Already connected */ || errno == EALREADY /* Previous attempt not complete */)
-      return;
+  IRC_SVR_COUNT = 0;
+  IRC_SVR_NEXT = 0;
+  IRC_SVR_EXPIRES = 0;
 
-    /* Try to connect again */
-    irc_reconnect();
+  if (inet_pton(AF_INET6, IRCItem->server, &addr6) > 0)
+    irc_svr_add(AF_INET6, &addr6);
+  else if (inet_pton(AF_INET, IRCItem->server, &addr4) > 0)
+    irc_svr_add(AF_INET, &addr4);
+
+  if (IRC_SVR_COUNT)
+  {
+    irc_connect();
     return;
   }
 
-  irc_send("NICK %s", IRCItem->nick);
+  IRC_STATE = IRC_RESOLVING;
+  IRC_RESOLVE_PENDING = 0;
 
-  if (!EmptyString(IRCItem->password))
-    irc_send("PASS %s", IRCItem->password);
+  /* Queries deferred by dns_fdlimit are answered later */
+  if (firedns_getip(FDNS_QRY_AAAA, IRCItem->server, irc_resolved, NULL) == 0 || firedns_errno == FDNS_ERR_FDLIMIT)
+    ++IRC_RESOLVE_PENDING;
+  else
+    IRC_RESOLVE_ERROR = firedns_errno;
 
-  irc_send("USER %s %s %s :%s",
-           IRCItem->username,
-           IRCItem->username,
-           IRCItem->username,
-           IRCItem->realname);
-  time(&IRC_LAST);
+  if (firedns_getip(FDNS_QRY_A, IRCItem->server, irc_resolved, NULL) == 0 || firedns_errno == FDNS_ERR_FDLIMIT)
+    ++IRC_RESOLVE_PENDING;
+  else
+    IRC_RESOLVE_ERROR = firedns_errno;
+
+  if (IRC_RESOLVE_PENDING == 0)
+  {
+    log_printf("IRC -> firedns_getip(\"%s\"): %s", IRCItem->server,
+               firedns_strerror(IRC_RESOLVE_ERROR));
+    irc_reconnect();
+  }
 }
 
 /* irc_parse
@@ -1737,11 +792,13 @@ irc_connect(void)
  *    irc_parse is called by irc_read when a full line of data
  *    is ready to be parsed.
  *
- * Parameters: NONE
+ * Parameters:
+ *    line: NUL terminated line, is modified while parsing
+ *
  * Return: NONE
  */
 static void
-irc_parse(void)
+irc_parse(char *line)
 {
   char *pos;
 
@@ -1782,31 +839,31 @@ irc_parse(void)
     { .command = NULL }
   };
 
-  if (IRC_RAW_LEN == 0)
+  if (*line == '\0')
     return;
 
   if (OPT_DEBUG >= 2)
-    log_printf("IRC READ -> %s", IRC_RAW);
+    log_printf("IRC READ -> %s", line);
 
   time(&IRC_LAST);
 
-  /* Store a copy of IRC_RAW for the handlers (for functions that need PROOF) */
-  strlcpy(msg, IRC_RAW, sizeof(msg));
+  /* Store a copy of line for the handlers (for functions that need PROOF) */
+  strlcpy(msg, line, sizeof(msg));
 
   /* parv[0] is always the source */
-  if (IRC_RAW[0] == ':')
-    parv[0] = IRC_RAW + 1;
+  if (line[0] == ':')
+    parv[0] = line + 1;
   else
   {
     parv[0] = IRCItem->server;
-    parv[parc++] = IRC_RAW;
+    parv[parc++] = line;
   }
 
-  pos = IRC_RAW;
+  pos = line;
 
   while ((pos = strchr(pos, ' ')) && parc <= 17)
   {
-    /* Avoid excessive spaces and end of IRC_RAW */
+    /* Avoid excessive spaces and end of line */
     if (*(pos + 1) == ' ' || *(pos + 1) == '\0')
     {
       pos++;
@@ -1855,40 +912,133 @@ irc_parse(void)
 static void
 irc_read(void)
 {
+  char *line, *end, *eol;
   ssize_t len;
-  char c;
 
-  while ((len = read(IRC_FD, &c, 1)) > 0)
+  len = recv(IRC_FD, IRC_RAW + IRC_RAW_LEN, sizeof(IRC_RAW) - IRC_RAW_LEN - 1, 0);
+
+  if (len <= 0)
   {
-    if (c == '\r')
-      continue;
+    if (len == -1 && (errno == EAGAIN || errno == EINTR))
+      return;
 
-    if (c == '\n')
-    {
-      /* Null string. */
-      IRC_RAW[IRC_RAW_LEN] = '\0';
+    if (len == 0)
+      log_printf("IRC -> Connection closed by server");
+    else
+      log_printf("IRC -> Error reading data from server: %s", strerror(errno));
+
+    irc_reconnect();
+    return;
+  }
 
-      /* Parse line. */
-      irc_parse();
+  IRC_RAW_LEN += len;
+  line = IRC_RAW;
+  end = IRC_RAW + IRC_RAW_LEN;
 
-      /* Reset counter. */
-      IRC_RAW_LEN = 0;
-      break;
-    }
+  /* Parse every complete line in place */
+  while ((eol = memchr(line, '\n', end - line)))
+  {
+    *eol = '\0';
+
+    if (eol > line && *(eol - 1) == '\r')
+      *(eol - 1) = '\0';
+
+    irc_parse(line);
+    line = eol + 1;
 
-    if (c != '\0')
-      IRC_RAW[IRC_RAW_LEN++] = c;
+    /* A handler may have dropped the connection */
+    if (IRC_FD == -1)
+      return;
   }
 
-  if ((len <= 0) && (errno != EAGAIN))
+  /* Move a partial line to the front of the buffer for the next read */
+  IRC_RAW_LEN = end - line;
+
+  if (IRC_RAW_LEN == sizeof(IRC_RAW) - 1)
   {
-    if (errno != EINTR)
-      log_printf("IRC -> Error reading data from server: %s", strerror(errno));
+    log_printf("IRC -> Discarding overlong line from server");
+    IRC_RAW_LEN = 0;
+  }
+  else if (IRC_RAW_LEN && line != IRC_RAW)
+    memmove(IRC_RAW, line, IRC_RAW_LEN);
+}
+
+/* irc_flush
+ *
+ *    Send as much of IRC_SENDQ as the server connection takes now.
+ *
+ * Parameters: NONE
+ * Return: NONE
+ */
+static void
+irc_flush(void)
+{
+  ssize_t len = send(IRC_FD, IRC_SENDQ, IRC_SENDQ_LEN, 0);
+
+  if (len == -1)
+  {
+    if (errno == EAGAIN || errno == EINTR)
+      return;
 
+    log_printf("IRC -> Error sending data to server: %s", strerror(errno));
     irc_reconnect();
-    IRC_RAW_LEN = 0;
     return;
   }
+
+  IRC_SENDQ_LEN -= len;
+  memmove(IRC_SENDQ, IRC_SENDQ + len, IRC_SENDQ_LEN);
+}
+
+/* irc_event
+ *
+ *    Called from event_wait() when the IRC server connection is ready.
+ *
+ * Parameters:
+ *    fd: IRC_FD
+ *    revents: poll() events that occurred
+ *    data: Unused
+ *
+ * Return: NONE
+ */
+static void
+irc_event(int fd, short revents, void *data)
+{
+  if (IRC_STATE == IRC_CONNECTING)
+  {
+    int error = 0;
+    socklen_t len = sizeof(error);
+
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len) == -1)
+      error = errno;
+
+    if (error == 0)
+    {
+      irc_connected();
+      return;
+    }
+
+    log_printf("IRC -> connect(): error connecting to %s: %s",
+               IRCItem->server, strerror(error));
+
+    close(IRC_FD);
+    IRC_FD = -1;
+    irc_connect();  /* Next address, if any */
+    return;
+  }
+
+  if (revents & POLLOUT)
+  {
+    irc_flush();
+
+    if (IRC_STATE != IRC_CONNECTED)
+      return;
+  }
+
+  /* Check if IRC data is available. */
+  if (revents & POLLIN)
+    irc_read();
+  else if (revents & (POLLERR | POLLHUP | POLLNVAL))
+    irc_reconnect();
 }
 
 /* irc_cycle
@@ -1904,45 +1054,46 @@ irc_read(void)
 void
 irc_cycle(void)
 {
-  static struct pollfd pfd;
-
-  if (IRC_FD == -1)
+  if (IRC_STATE == IRC_DISCONNECTED)
   {
+    time_t present;
+
+    time(&present);
+
+    if (present < IRC_NEXTCONNECT)
+    {
+      /* Scans go on meanwhile; come back when it is time */
+      event_timeout((IRC_NEXTCONNECT - present) * 1000);
+      return;
+    }
+
     /* Initialize negative cache. */
     if (OptionsItem->negcache)
       negcache_init();
 
-    /* Resolve remote host. */
-    irc_init();
+    IRC_LASTCONNECT = present;
 
-    /* Connect to remote host. */
-    irc_connect();
-    return;  /* In case connect() immediately failed */
+    /* Connect to remote host, resolving it first unless its addresses are still fresh */
+    if (IRC_SVR_COUNT && (IRC_SVR_EXPIRES == 0 || present < IRC_SVR_EXPIRES))
+    {
+      IRC_SVR_NEXT = 0;
+      irc_connect();
+    }
+    else
+      irc_resolve();
   }
 
-  pfd.fd = IRC_FD;
-  pfd.events = POLLIN;
-
-  /* Block .050 seconds to avoid excessive CPU use on poll(). */
-  switch (poll(&pfd, 1, 50))
-  {
-    case  0:
-    case -1:
-      break;
-    default:
-      /* Check if IRC data is available. */
-      if (pfd.revents & POLLIN)
-        irc_read();
-      else if (pfd.revents & (POLLERR | POLLHUP))
-        irc_reconnect();
-
-      break;
-  }
+  /* Wait for the connect() to finish, or for data, in event_wait() */
+  if (IRC_STATE == IRC_CONNECTING)
+    event_fd(IRC_FD, POLLOUT, irc_event, NULL);
+  else if (IRC_STATE == IRC_CONNECTED)
+    event_fd(IRC_FD, IRC_SENDQ_LEN ? POLLIN | POLLOUT : POLLIN, irc_event, NULL);
 }
 
 /* irc_send
  *
- *    Send data to remote IRC host.
+ *    Send data to remote IRC host. What the socket does not take at
+ *    once is queued for irc_flush(), or dropped if the queue is full.
  *
  * Parameters:
  *    data: Format of data to send
@@ -1955,7 +1106,7 @@ irc_send(const char *data, ...)
 {
   va_list arglist;
   char buf[MSGLENMAX];
-  size_t len = 0;
+  size_t len = 0, sent = 0;
 
   va_start(arglist, data);
   len = vsnprintf(buf, sizeof(buf), data, arglist);
@@ -1964,18 +1115,50 @@ irc_send(const char *data, ...)
   if (OPT_DEBUG >= 2)
     log_printf("IRC SEND -> %s", buf);
 
+  if (IRC_STATE != IRC_CONNECTED)
+  {
+    if (OPT_DEBUG)
+      log_printf("IRC -> Not connected, dropping: %s", buf);
+    return;
+  }
+
   if (len > 510)
     len = 510;
 
   buf[len++] = '\r';
   buf[len++] = '\n';
 
-  if (send(IRC_FD, buf, len, 0) == -1)
+  /* Lines must go out in order, so wait behind any that are queued */
+  if (IRC_SENDQ_LEN == 0)
   {
-    /* Return of -1 indicates error sending data; we reconnect. */
-    log_printf("IRC -> Error sending data to server: %s", strerror(errno));
-    irc_reconnect();
+    ssize_t ret = send(IRC_FD, buf, len, 0);
+
+    if (ret == -1)
+    {
+      if (errno != EAGAIN && errno != EINTR)
+      {
+        /* Return of -1 indicates error sending data; we reconnect. */
+        log_printf("IRC -> Error sending data to server: %s", strerror(errno));
+        irc_reconnect();
+        return;
+      }
+    }
+    else
+      sent = ret;
+
+    if (sent == len)
+      return;
+  }
+
+  /* The rest of a partly sent line always fits into the empty queue */
+  if (len - sent > sizeof(IRC_SENDQ) - IRC_SENDQ_LEN)
+  {
+    log_printf("IRC -> Send queue full, dropping: %.*s", (int)(len - 2), buf);
+    return;
   }
+
+  memcpy(IRC_SENDQ + IRC_SENDQ_LEN, buf + sent, len - sent);
+  IRC_SENDQ_LEN += len - sent;
 }
 
 /* irc_send_channels
@@ -2021,6 +1204,19 @@ irc_timer(void)
 
   time(&present);
 
+  if (IRC_STATE == IRC_CONNECTING && present - IRC_CONNECTSTART >= IRC_CONNECT_TIMEOUT)
+  {
+    log_printf("IRC -> connect(): timeout connecting to %s", IRCItem->server);
+
+    close(IRC_FD);
+    IRC_FD = -1;
+    irc_connect();  /* Next address, if any */
+    return;
+  }
+
+  if (IRC_STATE != IRC_CONNECTED)
+    return;
+
   delta = present - IRC_LAST;
 
   /* No data in IRCItem->readtimeout seconds */
@@ -2040,5 +1236,4 @@ irc_timer(void)
      */
     irc_send("PING :HOPM");
   }
->>>>>>> remotes/new/master
 }
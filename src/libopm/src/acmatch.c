@@ -0,0 +1,186 @@
+/*
+ *  Copyright (c) 2014-2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file acmatch.c
+ * \brief Matches proxy replies against the scanner's target strings.
+ * \version $Id$
+ *
+ * The target strings are compiled into an Aho-Corasick automaton in
+ * its DFA form: every state has a next state for each of the 256 input
+ * bytes, so matching costs one table lookup per byte received no matter
+ * how many target strings are configured. The state is kept per
+ * connection, so a target string split across reads or lines still
+ * matches.
+ */
+
+#include "setup.h"
+
+#include <string.h>
+
+#include "opm_common.h"
+#include "list.h"
+#include "memory.h"
+#include "acmatch.h"
+
+
+/* acmatch_create
+ *
+ *    Compile a list of target strings into a matcher.
+ *
+ * Parameters:
+ *    strings: List of target strings
+ *
+ * Return:
+ *    Address of the new matcher, NULL if the list is empty
+ */
+OPM_ACMATCH_T *
+libopm_acmatch_create(OPM_LIST_T *strings)
+{
+  OPM_ACMATCH_T *ret;
+  OPM_NODE_T *node;
+  unsigned int *fail, *queue;
+  unsigned int size = 1, head = 0, tail = 0;
+
+  if (LIST_SIZE(strings) == 0)
+    return NULL;
+
+  /* One state for the root plus at most one for every byte of every string */
+  LIST_FOREACH(node, strings->head)
+    size += strlen(node->data);
+
+  ret = libopm_calloc(sizeof(*ret));
+  ret->delta = libopm_calloc(sizeof(*ret->delta) * size * 256);
+  ret->accept = libopm_calloc(sizeof(*ret->accept) * size);
+  ret->states = 1;
+
+  /*
+   * Build the trie. The root is state 0, which no trie edge leads to,
+   * so 0 marks a missing edge for now.
+   */
+  LIST_FOREACH(node, strings->head)
+  {
+    unsigned int state = 0;
+
+    for (const unsigned char *p = node->data; *p; ++p)
+    {
+      unsigned int *next = &ret->delta[state * 256 + *p];
+
+      if (*next == 0)
+        *next = ret->states++;
+
+      state = *next;
+    }
+
+    ret->accept[state] = 1;
+  }
+
+  /*
+   * Walk the trie breadth first, so the failure state of every state
+   * has been completed before the state itself. Missing edges are
+   * replaced with the edge of the failure state.
+   */
+  fail = libopm_calloc(sizeof(*fail) * ret->states);
+  queue = libopm_calloc(sizeof(*queue) * ret->states);
+
+  for (unsigned int c = 0; c < 256; ++c)
+    if (ret->delta[c])
+      queue[tail++] = ret->delta[c];  /* fail[] of depth 1 states is the root */
+
+  while (head < tail)
+  {
+    unsigned int state = queue[head++];
+
+    if (ret->accept[fail[state]])
+      ret->accept[state] = 1;
+
+    for (unsigned int c = 0; c < 256; ++c)
+    {
+      unsigned int *next = &ret->delta[state * 256 + c];
+
+      if (*next)
+      {
+        fail[*next] = ret->delta[fail[state] * 256 + c];
+        queue[tail++] = *next;
+      }
+      else
+        *next = ret->delta[fail[state] * 256 + c];
+    }
+  }
+
+  libopm_free(fail);
+  libopm_free(queue);
+
+  return ret;
+}
+
+/* acmatch_free
+ *
+ *    Free a matcher created by libopm_acmatch_create.
+ *
+ * Parameters:
+ *    match: Matcher to free, may be NULL
+ *
+ * Return:
+ *    None
+ */
+void
+libopm_acmatch_free(OPM_ACMATCH_T *match)
+{
+  if (match == NULL)
+    return;
+
+  libopm_free(match->delta);
+  libopm_free(match->accept);
+  libopm_free(match);
+}
+
+/* acmatch_run
+ *
+ *    Feed a chunk of data to the matcher, stopping at the first match.
+ *
+ * Parameters:
+ *    match: Matcher to run
+ *    state: Current state, 0 at the start of the stream; updated
+ *    buf: Data to feed
+ *    length: Number of bytes in buf
+ *
+ * Return:
+ *    Number of bytes consumed up to and including the end of the first
+ *    target string found, 0 if none was found
+ */
+size_t
+libopm_acmatch_run(const OPM_ACMATCH_T *match, unsigned int *state, const char *buf, size_t length)
+{
+  const unsigned char *p = (const unsigned char *)buf;
+  unsigned int s = *state;
+
+  for (size_t i = 0; i < length; ++i)
+  {
+    s = match->delta[s * 256 + p[i]];
+
+    if (match->accept[s])
+    {
+      *state = s;
+      return i + 1;
+    }
+  }
+
+  *state = s;
+  return 0;
+}
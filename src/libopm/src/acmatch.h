@@ -0,0 +1,42 @@
+/*
+ *  Copyright (c) 2014-2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file acmatch.h
+ * \brief A header for the target string matcher.
+ * \version $Id$
+ */
+
+#ifndef ACMATCH_H
+#define ACMATCH_H
+
+#include <stddef.h>
+
+typedef struct _OPM_ACMATCH OPM_ACMATCH_T;
+
+struct _OPM_ACMATCH
+{
+  unsigned int  *delta;                /* Next state for each state and input byte, 256 per state */
+  unsigned char *accept;               /* Non-zero for states that complete a target string       */
+  unsigned int   states;               /* Number of states in use                                 */
+};
+
+extern OPM_ACMATCH_T *libopm_acmatch_create(OPM_LIST_T *);
+extern void libopm_acmatch_free(OPM_ACMATCH_T *);
+extern size_t libopm_acmatch_run(const OPM_ACMATCH_T *, unsigned int *, const char *, size_t);
+#endif /* ACMATCH_H */
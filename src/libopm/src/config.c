@@ -46,7 +46,8 @@ static const OPM_CONFIG_HASH_T HASH[] =
   { OPM_CONFIG_SCAN_IP,       OPM_TYPE_STRING     },
   { OPM_CONFIG_SCAN_PORT,     OPM_TYPE_INT        },
   { OPM_CONFIG_MAX_READ,      OPM_TYPE_INT        },
-  { OPM_CONFIG_TIMEOUT,       OPM_TYPE_INT        }
+  { OPM_CONFIG_TIMEOUT,       OPM_TYPE_INT        },
+  { OPM_CONFIG_CONNECT_RATE,  OPM_TYPE_INT        }
 };
 
 /* config_create
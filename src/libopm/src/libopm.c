@@ -30,6 +30,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <poll.h>
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif
 #ifdef HAVE_LIBCRYPTO
 #include <openssl/ssl.h>
 #endif
@@ -42,28 +45,41 @@
 #include "opm_common.h"
 #include "list.h"
 #include "proxy.h"
+#include "acmatch.h"
+#include "pool.h"
 
 
 static OPM_PROTOCOL_CONFIG_T *libopm_protocol_config_create(void);
 static void libopm_protocol_config_free(OPM_PROTOCOL_CONFIG_T *);
 
 static OPM_SCAN_T *libopm_scan_create(OPM_T *, OPM_REMOTE_T *);
-static void libopm_scan_free(OPM_SCAN_T *);
+static void libopm_scan_free(OPM_T *, OPM_SCAN_T *);
 
-static OPM_CONNECTION_T *libopm_connection_create(void);
-static void libopm_connection_free(OPM_CONNECTION_T *);
+static OPM_CONNECTION_T *libopm_connection_create(OPM_T *);
+static void libopm_connection_free(OPM_T *, OPM_CONNECTION_T *);
 
 static void libopm_check_establish(OPM_T *);
 static void libopm_check_poll(OPM_T *);
+#ifdef HAVE_SYS_EPOLL_H
+static void libopm_check_epoll(OPM_T *);
+#endif
 static void libopm_check_closed(OPM_T *);
 static void libopm_check_queue(OPM_T *);
 
+static void libopm_connect_refill(OPM_T *);
+static int libopm_connect_take(OPM_T *);
+
 static void libopm_do_connect(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *);
+static int libopm_do_watch(OPM_T *, OPM_CONNECTION_T *, short);
+static void libopm_do_close(OPM_T *, OPM_CONNECTION_T *);
+static void libopm_timer_link(OPM_CONNECTION_T **, OPM_CONNECTION_T *);
+static void libopm_timer_unlink(OPM_CONNECTION_T *);
 static void libopm_do_readready(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *);
+static void libopm_do_readbuf(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *, const char *, size_t);
 static int libopm_do_readready_tls(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *);
+static int libopm_do_handshake(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *);
 static void libopm_do_writeready(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *);
 static void libopm_do_hup(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *);
-static void libopm_do_read(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *);
 static void libopm_do_openproxy(OPM_T *, OPM_SCAN_T *, OPM_CONNECTION_T *);
 static void libopm_do_callback(OPM_T *, OPM_REMOTE_T *, int, int);
 
@@ -110,10 +126,23 @@ opm_create(void)
   ret->scans = libopm_list_create();
   ret->queue = libopm_list_create();
   ret->protocols = libopm_list_create();
+  ret->wheel = libopm_calloc(sizeof(*ret->wheel) * LIBOPM_WHEEL_SIZE);
+  time(&ret->wheel_time);
+
+#ifdef HAVE_SYS_EPOLL_H
+  ret->epfd = epoll_create1(EPOLL_CLOEXEC);
+#else
+  ret->epfd = -1;
+#endif
 
   /* Setup callbacks */
   ret->callbacks = libopm_calloc(sizeof(OPM_CALLBACK_T) * CBLEN);
 
+  /* Setup object pools */
+  ret->pools = libopm_calloc(sizeof(*ret->pools) * POOLLEN);
+  ret->pools[OPM_POOL_SCAN] = libopm_pool_create(sizeof(OPM_SCAN_T), 32);
+  ret->pools[OPM_POOL_CONNECTION] = libopm_pool_create(sizeof(OPM_CONNECTION_T), 128);
+
   return ret;
 }
 
@@ -213,6 +242,7 @@ opm_free(OPM_T *scanner)
   OPM_SCAN_T *scan;
 
   libopm_config_free(scanner->config);
+  libopm_acmatch_free(scanner->match);
 
   LIST_FOREACH_SAFE(p, next, scanner->protocols->head)
   {
@@ -227,24 +257,30 @@ opm_free(OPM_T *scanner)
   {
     scan = p->data;
 
-    libopm_scan_free(scan);
     libopm_list_remove(scanner->scans, p);
-    libopm_node_free(p);
+    libopm_scan_free(scanner, scan);
   }
 
   LIST_FOREACH_SAFE(p, next, scanner->queue->head)
   {
     scan = p->data;
 
-    libopm_scan_free(scan);
     libopm_list_remove(scanner->queue, p);
-    libopm_node_free(p);
+    libopm_scan_free(scanner, scan);
   }
 
   libopm_list_free(scanner->protocols);
   libopm_list_free(scanner->scans);
   libopm_list_free(scanner->queue);
+  libopm_free(scanner->wheel);
+
+  if (scanner->epfd > -1)
+    close(scanner->epfd);
+
+  for (unsigned int i = 0; i < POOLLEN; ++i)
+    libopm_pool_free(scanner->pools[i]);
 
+  libopm_free(scanner->pools);
   libopm_free(scanner->callbacks);
   libopm_free(scanner);
 }
@@ -265,7 +301,16 @@ opm_free(OPM_T *scanner)
 OPM_ERR_T
 opm_config(OPM_T *scanner, int key, const void *value)
 {
-  return libopm_config_set(scanner->config, key, value);
+  OPM_ERR_T ret = libopm_config_set(scanner->config, key, value);
+
+  /* Recompile the matcher whenever a target string is added */
+  if (ret == OPM_SUCCESS && key == OPM_CONFIG_TARGET_STRING)
+  {
+    libopm_acmatch_free(scanner->match);
+    scanner->match = libopm_acmatch_create(libopm_config(scanner->config, OPM_CONFIG_TARGET_STRING));
+  }
+
+  return ret;
 }
 
 /* opm_addtype
@@ -385,6 +430,33 @@ libopm_protocol_config_free(OPM_PROTOCOL_CONFIG_T *protocol)
   libopm_free(protocol);
 }
 
+/* opm_addr_parse
+ *
+ *    Convert a readable IPv4 or IPv6 address to an OPM_ADDR_T, so
+ *    callers that need the address in several places parse it once.
+ *
+ * Parameters:
+ *    addr: Where to store the address, family is 0 on failure
+ *    ip:   Readable IP address
+ *
+ * Return:
+ *    OPM_SUCCESS, or OPM_ERR_BADADDR if ip is not an address
+ */
+OPM_ERR_T
+opm_addr_parse(OPM_ADDR_T *addr, const char *ip)
+{
+  memset(addr, 0, sizeof(*addr));
+
+  if (inet_pton(AF_INET, ip, addr->bytes) > 0)
+    addr->family = AF_INET;
+  else if (inet_pton(AF_INET6, ip, addr->bytes) > 0)
+    addr->family = AF_INET6;
+  else
+    return OPM_ERR_BADADDR;
+
+  return OPM_SUCCESS;
+}
+
 /* opm_scan
  *
  *    Scan remote host. The opm_scan function takes an OPM_REMOTE_T
@@ -396,32 +468,51 @@ libopm_protocol_config_free(OPM_PROTOCOL_CONFIG_T *protocol)
  *    remote:  OPM_REMOTE_T defining remote host
  *
  * Return:
- *    (to be written)
+ *    See opm_scan_addr
  */
 OPM_ERR_T
 opm_scan(OPM_T *scanner, OPM_REMOTE_T *remote)
+{
+  OPM_ADDR_T addr;
+
+  if (opm_addr_parse(&addr, remote->ip) != OPM_SUCCESS)
+    return OPM_ERR_BADADDR;
+
+  return opm_scan_addr(scanner, remote, &addr);
+}
+
+/* opm_scan_addr
+ *
+ *    Like opm_scan, for callers that already have the address of the
+ *    remote host in binary form. remote->ip is only used for reporting.
+ *
+ * Parameters:
+ *    scanner: Scanner to scan host on
+ *    remote:  OPM_REMOTE_T defining remote host
+ *    addr:    Address of the remote host
+ *
+ * Return:
+ *    OPM_SUCCESS, OPM_ERR_NOPROTOCOLS if there is nothing to scan for,
+ *    or OPM_ERR_BADADDR if addr is not an IPv4 address
+ */
+OPM_ERR_T
+opm_scan_addr(OPM_T *scanner, OPM_REMOTE_T *remote, const OPM_ADDR_T *addr)
 {
   OPM_SCAN_T *scan;  /* New scan for OPM_T */
-  OPM_NODE_T *node;  /* Node we'll add scan to when we link it to scans */
-  struct in_addr in;
 
   if (LIST_SIZE(scanner->protocols) == 0 &&
       LIST_SIZE(remote->protocols) == 0)
     return OPM_ERR_NOPROTOCOLS;
 
-  /*
-   * XXX: libopm ideally shouldn't see an IP address in string representation.
-   * Could have been stuffed into the _OPM_REMOTE struct by the caller that
-   * already does getaddrinfo() anyway.
-   */
-  if (inet_pton(AF_INET, remote->ip, &in) <= 0)
+  if (addr->family != AF_INET)
     return OPM_ERR_BADADDR;
 
+  remote->addr = *addr;
+
   scan = libopm_scan_create(scanner, remote);
-  memcpy(&scan->addr.sin_addr, &in, sizeof(scan->addr.sin_addr));
+  memcpy(&scan->addr.sin_addr, addr->bytes, sizeof(scan->addr.sin_addr));
 
-  node = libopm_node_create(scan);
-  libopm_list_add(scanner->queue, node);
+  libopm_list_add(scanner->queue, &scan->node);
 
   return OPM_SUCCESS;
 }
@@ -440,9 +531,8 @@ opm_scan(OPM_T *scanner, OPM_REMOTE_T *remote)
 void
 opm_end(OPM_T *scanner, OPM_REMOTE_T *remote)
 {
-  OPM_NODE_T *node1, *node2, *next1, *next2;
+  OPM_NODE_T *node1, *next1;
   OPM_SCAN_T *scan;
-  OPM_CONNECTION_T *conn;
 
   /* End active scans */
   opm_endscan(scanner, remote);
@@ -457,24 +547,12 @@ opm_end(OPM_T *scanner, OPM_REMOTE_T *remote)
 
     if (scan->remote == remote)
     {
-      /* Free all connections */
-      LIST_FOREACH_SAFE(node2, next2, scan->connections->head)
-      {
-        conn = node2->data;
-
-        libopm_list_remove(scan->connections, node2);
-        libopm_connection_free(conn);
-        libopm_node_free(node2);
-        continue;
-      }
-
       /* OPM_CALLBACK_END because check_closed normally handles this */
       libopm_do_callback(scanner, scan->remote, OPM_CALLBACK_END, 0);
 
-      /* Free up the scan */
+      /* Free up the scan and all its connections */
       libopm_list_remove(scanner->queue, node1);
-      libopm_scan_free(scan);
-      libopm_node_free(node1);
+      libopm_scan_free(scanner, scan);
     }
   }
 }
@@ -510,10 +588,10 @@ opm_endscan(OPM_T *scanner, OPM_REMOTE_T *remote)
 
     if (scan->remote == remote)
     {
-      LIST_FOREACH(node2, scan->connections->head)
+      LIST_FOREACH(node2, scan->connections.head)
       {
         conn = node2->data;
-        conn->state = OPM_STATE_CLOSED;
+        libopm_do_close(scanner, conn);
       }
     }
   }
@@ -535,6 +613,75 @@ opm_active(OPM_T *scanner)
   return LIST_SIZE(scanner->queue) + LIST_SIZE(scanner->scans);
 }
 
+/* opm_pollfd
+
+      Return a descriptor that becomes readable whenever one of the
+      scanner's connections is ready for IO, so the client can wait on
+      it in its own event loop before calling opm_cycle().
+
+   Parameters:
+      scanner: Scanner to return the descriptor of
+
+   Return:
+      The epoll descriptor, or -1 if the scanner is using poll() and
+      opm_cycle() must be called periodically instead.
+*/
+int
+opm_pollfd(OPM_T *scanner)
+{
+  return scanner->epfd;
+}
+
+/* opm_timeout
+
+      Return how long the client may wait on opm_pollfd() before it has
+      to call opm_cycle() again, for work no descriptor signals: new
+      connections held back by OPM_CONFIG_CONNECT_RATE.
+
+   Parameters:
+      scanner: Scanner to check
+
+   Return:
+      Milliseconds until opm_cycle() has work to do, or -1 if only IO
+      (or the once a second timeout check) will create any.
+*/
+int
+opm_timeout(OPM_T *scanner)
+{
+  int rate = *(int *)libopm_config(scanner->config, OPM_CONFIG_CONNECT_RATE);
+
+  if (!scanner->connect_wait || rate <= 0)
+    return -1;
+
+  if (scanner->connect_credit >= 1000)
+    return 0;
+
+  return (1000 - scanner->connect_credit + rate - 1) / rate;
+}
+
+/* opm_pool_stats
+
+      Report how many objects of one type the scanner has allocated and
+      how many of them are in use, to help size fd_limit.
+
+   Parameters:
+      scanner: Scanner to report on
+      type: OPM_POOL_SCAN or OPM_POOL_CONNECTION
+      stats: Filled in with the pool's counters
+
+   Return:
+      OPM_SUCCESS, or OPM_ERR_BADKEY if type is unknown
+*/
+OPM_ERR_T
+opm_pool_stats(OPM_T *scanner, int type, OPM_POOL_STATS_T *stats)
+{
+  if (type < 0 || type >= POOLLEN)
+    return OPM_ERR_BADKEY;
+
+  *stats = scanner->pools[type]->stats;
+  return OPM_SUCCESS;
+}
+
 /* scan_create
  *
  *    Create new OPM_SCAN_T struct
@@ -554,7 +701,7 @@ libopm_scan_create(OPM_T *scanner, OPM_REMOTE_T *remote)
 {
   OPM_SCAN_T *ret;
   OPM_CONNECTION_T *conn;
-  OPM_NODE_T *node, *p;
+  OPM_NODE_T *p;
 #ifdef HAVE_LIBCRYPTO
   static int tls_init = 0;
   static SSL_CTX *ctx_client;
@@ -570,15 +717,16 @@ libopm_scan_create(OPM_T *scanner, OPM_REMOTE_T *remote)
   }
 #endif
 
-  ret = libopm_calloc(sizeof(*ret));
+  ret = libopm_pool_alloc(scanner->pools[OPM_POOL_SCAN]);
   ret->remote = remote;
-  ret->connections = libopm_list_create();
+  ret->node.data = ret;
 
   /* Setup list of connections, one for each protocol */
   LIST_FOREACH(p, scanner->protocols->head)
   {
-    conn = libopm_connection_create();
+    conn = libopm_connection_create(scanner);
 
+    conn->scan     = ret;
     conn->protocol = ((OPM_PROTOCOL_CONFIG_T *)p->data)->type;
     conn->port     = ((OPM_PROTOCOL_CONFIG_T *)p->data)->port;
 
@@ -588,8 +736,7 @@ libopm_scan_create(OPM_T *scanner, OPM_REMOTE_T *remote)
       conn->tls_handle = SSL_new(ctx_client);
 #endif
 
-    node = libopm_node_create(conn);
-    libopm_list_add(ret->connections, node);
+    libopm_list_add(&ret->connections, &conn->node);
   }
 
   /*
@@ -597,8 +744,9 @@ libopm_scan_create(OPM_T *scanner, OPM_REMOTE_T *remote)
    */
   LIST_FOREACH(p, remote->protocols->head)
   {
-    conn = libopm_connection_create();
+    conn = libopm_connection_create(scanner);
 
+    conn->scan     = ret;
     conn->protocol = ((OPM_PROTOCOL_CONFIG_T *)p->data)->type;
     conn->port     = ((OPM_PROTOCOL_CONFIG_T *)p->data)->port;
 
@@ -608,8 +756,7 @@ libopm_scan_create(OPM_T *scanner, OPM_REMOTE_T *remote)
       conn->tls_handle = SSL_new(ctx_client);
 #endif
 
-    node = libopm_node_create(conn);
-    libopm_list_add(ret->connections, node);
+    libopm_list_add(&ret->connections, &conn->node);
   }
 
   return ret;
@@ -620,29 +767,24 @@ libopm_scan_create(OPM_T *scanner, OPM_REMOTE_T *remote)
  *    Free and cleanup OPM_SCAN_T struct
  *
  * Parametsr:
+ *    scanner: Scanner the scan belongs to
  *    scan: Scan struct to free
  *
  * Return:
  *    None
  */
 static void
-libopm_scan_free(OPM_SCAN_T *scan)
+libopm_scan_free(OPM_T *scanner, OPM_SCAN_T *scan)
 {
   OPM_NODE_T *p, *next;
-  OPM_CONNECTION_T *conn;
 
-  LIST_FOREACH_SAFE(p, next, scan->connections->head)
+  LIST_FOREACH_SAFE(p, next, scan->connections.head)
   {
-    conn = p->data;
-
-    libopm_connection_free(conn);
-    libopm_list_remove(scan->connections, p);
-    libopm_node_free(p);
+    libopm_list_remove(&scan->connections, p);
+    libopm_connection_free(scanner, p->data);
   }
 
-  libopm_list_free(scan->connections);
-
-  libopm_free(scan);
+  libopm_pool_release(scanner->pools[OPM_POOL_SCAN], scan);
 }
 
 /* connection_create
@@ -650,17 +792,19 @@ libopm_scan_free(OPM_SCAN_T *scan)
  *    Allocate new OPM_CONNECTION_T
  *
  * Parameters:
- *    None
+ *    scanner: Scanner the connection is made for
  *
  * Return:
  *    Address of new OPM_CONNECTION_T
  */
 static OPM_CONNECTION_T *
-libopm_connection_create(void)
+libopm_connection_create(OPM_T *scanner)
 {
   OPM_CONNECTION_T *ret;
 
-  ret = libopm_calloc(sizeof(*ret));
+  ret = libopm_pool_alloc(scanner->pools[OPM_POOL_CONNECTION]);
+  ret->node.data = ret;
+  ret->fd = -1;
   ret->state = OPM_STATE_UNESTABLISHED;
 
   return ret;
@@ -671,15 +815,16 @@ libopm_connection_create(void)
  *    Free OPM_CONNECTION_T struct
  *
  * Parameters:
+ *    scanner: Scanner the connection belongs to
  *    conn: Address of struct to free
  *
  * Return:
  *    None
  */
 static void
-libopm_connection_free(OPM_CONNECTION_T *conn)
+libopm_connection_free(OPM_T *scanner, OPM_CONNECTION_T *conn)
 {
-  libopm_free(conn);
+  libopm_pool_release(scanner->pools[OPM_POOL_CONNECTION], conn);
 }
 
 /* opm_cycle
@@ -694,10 +839,27 @@ libopm_connection_free(OPM_CONNECTION_T *conn)
 void
 opm_cycle(OPM_T *scanner)
 {
+  unsigned int fd_use;
+
+  time(&scanner->present);          /* One timestamp for everything done this cycle    */
+  libopm_connect_refill(scanner);   /* Credit connects for the time since the last one */
+
   libopm_check_queue(scanner);      /* Move scans from the queue to the live scan list */
   libopm_check_establish(scanner);  /* Make new connections if possible                */
   libopm_check_poll(scanner);       /* Poll connections for IO  and proxy test         */
+
+  fd_use = scanner->fd_use;
   libopm_check_closed(scanner);     /* Check for closed or timed out connections       */
+
+  /*
+   * Reuse the descriptors freed above right away, the client may not
+   * call us again until some IO is ready.
+   */
+  if (scanner->fd_use < fd_use)
+  {
+    libopm_check_queue(scanner);
+    libopm_check_establish(scanner);
+  }
 }
 
 /* check_queue
@@ -732,7 +894,7 @@ libopm_check_queue(OPM_T *scanner)
   {
     /* Grab the top scan */
     scan = scanner->queue->head->data;
-    protocols = LIST_SIZE(scan->connections);
+    protocols = LIST_SIZE(&scan->connections);
 
     /* Check if it will fit in the live scan list */
     if ((protocols + projected) > fd_limit)
@@ -766,6 +928,8 @@ libopm_check_establish(OPM_T *scanner)
   OPM_CONNECTION_T *conn;
   unsigned int fd_limit;
 
+  scanner->connect_wait = 0;
+
   if (LIST_SIZE(scanner->scans) == 0)
     return;
 
@@ -778,7 +942,7 @@ libopm_check_establish(OPM_T *scanner)
   {
     scan = node1->data;
 
-    LIST_FOREACH(node2, scan->connections->head)
+    LIST_FOREACH(node2, scan->connections.head)
     {
       /* Only scan if we have free file descriptors */
       if (scanner->fd_use >= fd_limit)
@@ -786,16 +950,84 @@ libopm_check_establish(OPM_T *scanner)
 
       conn = node2->data;
 
-      if (conn->state == OPM_STATE_UNESTABLISHED)
-        libopm_do_connect(scanner, scan, conn);
+      if (conn->state != OPM_STATE_UNESTABLISHED)
+        continue;
+
+      /* Out of connect credit, opm_timeout() tells when there is more */
+      if (!libopm_connect_take(scanner))
+      {
+        scanner->connect_wait = 1;
+        return;
+      }
+
+      libopm_do_connect(scanner, scan, conn);
     }
   }
 }
 
+/* connect_refill
+ *
+ * Credit the scanner with the connects OPM_CONFIG_CONNECT_RATE allows
+ * for the time passed since the last refill. Credit is capped at a
+ * tenth of a second worth of connects (at least one), so an idle
+ * scanner does not save up a burst.
+ *
+ * Parameters:
+ *   scanner: Scanner to refill
+ * Return:
+ *   None
+ */
+static void
+libopm_connect_refill(OPM_T *scanner)
+{
+  int rate = *(int *)libopm_config(scanner->config, OPM_CONFIG_CONNECT_RATE);
+  uint64_t now, burst;
+  struct timespec ts;
+
+  if (rate <= 0)
+    return;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  now = (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+
+  burst = 1000 * (uint64_t)(rate >= 10 ? rate / 10 : 1);
+
+  if (scanner->connect_time == 0 || (now - scanner->connect_time) * rate >= burst)
+    scanner->connect_credit = burst;
+  else if ((scanner->connect_credit += (now - scanner->connect_time) * rate) > burst)
+    scanner->connect_credit = burst;
+
+  scanner->connect_time = now;
+}
+
+/* connect_take
+ *
+ * Take the credit for one connect.
+ *
+ * Parameters:
+ *   scanner: Scanner about to connect
+ * Return:
+ *   1 if the connect may be made now, 0 if it has to wait
+ */
+static int
+libopm_connect_take(OPM_T *scanner)
+{
+  int rate = *(int *)libopm_config(scanner->config, OPM_CONFIG_CONNECT_RATE);
+
+  if (rate <= 0)
+    return 1;
+
+  if (scanner->connect_credit < 1000)
+    return 0;
+
+  scanner->connect_credit -= 1000;
+  return 1;
+}
+
 /* check_closed
  *
- * Check for connections which have timed out or are
- * closed. Connections timed out still need to be closed.
+ * Time out connections whose second in the timeout wheel has come, then
+ * free closed connections. Connections timed out still need to be closed.
  *
  * Remove the connection from the list of connections, free
  * the connection struct and free the list node. Then if this is
@@ -812,84 +1044,154 @@ libopm_check_closed(OPM_T *scanner)
 {
   time_t present;
   int timeout;
-  OPM_NODE_T *node1, *node2, *next1, *next2;
+  unsigned int ticks = 0;
   OPM_SCAN_T *scan;
-  OPM_CONNECTION_T *conn;
-
-  if (LIST_SIZE(scanner->scans) == 0)
-    return;
+  OPM_CONNECTION_T *conn, *pending;
 
-  time(&present);
+  present = scanner->present;
   timeout = *(int *)libopm_config(scanner->config, OPM_CONFIG_TIMEOUT);
 
-  LIST_FOREACH_SAFE(node1, next1, scanner->scans->head)
+  /* Visit each slot the wheel passed since the last call, at most once */
+  while (scanner->wheel_time < present && ticks++ < LIBOPM_WHEEL_SIZE)
   {
-    scan = node1->data;
+    OPM_CONNECTION_T **slot = &scanner->wheel[++scanner->wheel_time % LIBOPM_WHEEL_SIZE];
+
+    /*
+     * Detach the slot, so connections that are not due for another
+     * turn of the wheel can be put back while it is walked.
+     */
+    pending = *slot;
+    *slot = NULL;
 
-    LIST_FOREACH_SAFE(node2, next2, scan->connections->head)
+    for (conn = pending; conn; conn = conn->timer_next)
+      conn->timer_list = &pending;
+
+    while ((conn = pending))
     {
-      conn = node2->data;
+      libopm_timer_unlink(conn);
 
-      if (conn->state == OPM_STATE_CLOSED)
+      if ((present - conn->creation) >= timeout)
       {
-#ifdef HAVE_LIBCRYPTO
-        if (conn->protocol->use_tls)
-        {
-          SSL_set_shutdown(conn->tls_handle, SSL_RECEIVED_SHUTDOWN);
-          if (!SSL_shutdown(conn->tls_handle))
-            SSL_shutdown(conn->tls_handle);
-          SSL_free(conn->tls_handle);
-        }
-#endif
-        if (conn->fd > -1)
-          close(conn->fd);
+        libopm_do_callback(scanner, libopm_setup_remote(conn->scan->remote, conn), OPM_CALLBACK_TIMEOUT, 0);
+        libopm_do_close(scanner, conn);
+      }
+      else
+        libopm_timer_link(&scanner->wheel[(conn->creation + timeout) % LIBOPM_WHEEL_SIZE], conn);
+    }
+  }
 
-        scanner->fd_use--;
+  scanner->wheel_time = present;
 
-        libopm_list_remove(scan->connections, node2);
-        libopm_connection_free(conn);
-        libopm_node_free(node2);
-        continue;
-      }
+  while ((conn = scanner->closed))
+  {
+    scan = conn->scan;
+    libopm_timer_unlink(conn);
 
-      if (((present - conn->creation) >= timeout) && conn->state != OPM_STATE_UNESTABLISHED)
-      {
 #ifdef HAVE_LIBCRYPTO
-        if (conn->protocol->use_tls)
-        {
-          SSL_set_shutdown(conn->tls_handle, SSL_RECEIVED_SHUTDOWN);
-          if (!SSL_shutdown(conn->tls_handle))
-            SSL_shutdown(conn->tls_handle);
-          SSL_free(conn->tls_handle);
-        }
+    if (conn->protocol->use_tls)
+    {
+      SSL_set_shutdown(conn->tls_handle, SSL_RECEIVED_SHUTDOWN);
+      if (!SSL_shutdown(conn->tls_handle))
+        SSL_shutdown(conn->tls_handle);
+      SSL_free(conn->tls_handle);
+    }
 #endif
-        if (conn->fd > -1)
-          close(conn->fd);
-
-        scanner->fd_use--;
-
-        libopm_do_callback(scanner, libopm_setup_remote(scan->remote, conn), OPM_CALLBACK_TIMEOUT, 0);
-        libopm_list_remove(scan->connections, node2);
-        libopm_connection_free(conn);
-        libopm_node_free(node2);
-        continue;
-      }
+    if (conn->fd > -1)
+    {
+      close(conn->fd);
+      scanner->fd_use--;
     }
 
+    libopm_list_remove(&scan->connections, &conn->node);
+    libopm_connection_free(scanner, conn);
+
     /*
      * No more connections left in this scan, let the client know the scan has
      * ended, then remove the scan from the scanner, and free it up.
      */
-    if (LIST_SIZE(scan->connections) == 0)
+    if (LIST_SIZE(&scan->connections) == 0)
     {
       libopm_do_callback(scanner, scan->remote, OPM_CALLBACK_END, 0);
-      libopm_list_remove(scanner->scans, node1);
-      libopm_scan_free(scan);
-      libopm_node_free(node1);
+      libopm_list_remove(scanner->scans, &scan->node);
+      libopm_scan_free(scanner, scan);
     }
   }
 }
 
+/* do_close
+ *
+ * Mark a connection closed and queue it for check_closed to free.
+ *
+ * Parameters:
+ *    scanner: Scanner the connection belongs to
+ *    conn: Connection to close
+ * Return:
+ *    None
+ */
+static void
+libopm_do_close(OPM_T *scanner, OPM_CONNECTION_T *conn)
+{
+  if (conn->state == OPM_STATE_CLOSED)
+    return;
+
+  conn->state = OPM_STATE_CLOSED;
+
+  libopm_timer_unlink(conn);
+  libopm_timer_link(&scanner->closed, conn);
+}
+
+/* timer_link
+ *
+ * Insert a connection at the head of a timeout wheel slot or the
+ * closed list.
+ *
+ * Parameters:
+ *    list: Head of the list
+ *    conn: Connection to insert
+ * Return:
+ *    None
+ */
+static void
+libopm_timer_link(OPM_CONNECTION_T **list, OPM_CONNECTION_T *conn)
+{
+  conn->timer_list = list;
+  conn->timer_prev = NULL;
+  conn->timer_next = *list;
+
+  if (*list)
+    (*list)->timer_prev = conn;
+
+  *list = conn;
+}
+
+/* timer_unlink
+ *
+ * Remove a connection from the wheel slot or closed list it is on.
+ *
+ * Parameters:
+ *    conn: Connection to remove
+ * Return:
+ *    None
+ */
+static void
+libopm_timer_unlink(OPM_CONNECTION_T *conn)
+{
+  if (conn->timer_list == NULL)
+    return;
+
+  if (conn->timer_prev)
+    conn->timer_prev->timer_next = conn->timer_next;
+  else
+    *conn->timer_list = conn->timer_next;
+
+  if (conn->timer_next)
+    conn->timer_next->timer_prev = conn->timer_prev;
+
+  conn->timer_list = NULL;
+  conn->timer_next = NULL;
+  conn->timer_prev = NULL;
+}
+
 /* do_connect
  *
  * Call socket() and connect() to start a scan.
@@ -906,6 +1208,7 @@ libopm_do_connect(OPM_T * scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
   struct sockaddr_in *bind_ip;
   struct sockaddr_in *addr;  /* Outgoing host */
   struct sockaddr_in local_addr;  /* For binding */
+  int timeout;
 
   addr = &scan->addr;  /* Already have the IP in byte format from opm_scan */
   addr->sin_family = AF_INET;
@@ -913,16 +1216,21 @@ libopm_do_connect(OPM_T * scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
 
   bind_ip = (struct sockaddr_in *)libopm_config(scanner->config, OPM_CONFIG_BIND_IP);
 
+#ifdef SOCK_NONBLOCK
+  conn->fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+#else
   conn->fd = socket(AF_INET, SOCK_STREAM, 0);
-  scanner->fd_use++;  /* Increase file descriptor use */
+#endif
 
   if (conn->fd == -1)
   {
     libopm_do_callback(scanner, libopm_setup_remote(scan->remote, conn), OPM_CALLBACK_ERROR, OPM_ERR_NOFD);
-    conn->state = OPM_STATE_CLOSED;
+    libopm_do_close(scanner, conn);
     return;
   }
 
+  scanner->fd_use++;  /* Increase file descriptor use */
+
   if (bind_ip)
   {
     memset(&local_addr, 0, sizeof(local_addr));
@@ -934,13 +1242,15 @@ libopm_do_connect(OPM_T * scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
     if (bind(conn->fd, (struct sockaddr *)&local_addr, sizeof(local_addr)) == -1)
     {
       libopm_do_callback(scanner, libopm_setup_remote(scan->remote, conn), OPM_CALLBACK_ERROR, OPM_ERR_BIND);
-      conn->state = OPM_STATE_CLOSED;
+      libopm_do_close(scanner, conn);
       return;
     }
   }
 
+#ifndef SOCK_NONBLOCK
   /* Set socket non blocking */
   fcntl(conn->fd, F_SETFL, O_NONBLOCK);
+#endif
 
   connect(conn->fd, (struct sockaddr *)addr, sizeof(*addr));
 
@@ -950,7 +1260,60 @@ libopm_do_connect(OPM_T * scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
 #endif
 
   conn->state = OPM_STATE_ESTABLISHED;
-  time(&conn->creation);  /* Stamp creation time, for timeout */
+  conn->creation = scanner->present;  /* Stamp creation time, for timeout */
+
+  /* Hash into the timeout wheel by the second the connection times out */
+  timeout = *(int *)libopm_config(scanner->config, OPM_CONFIG_TIMEOUT);
+  libopm_timer_link(&scanner->wheel[(conn->creation + timeout) % LIBOPM_WHEEL_SIZE], conn);
+
+  libopm_do_watch(scanner, conn, POLLOUT);
+}
+
+/* do_watch
+ *
+ * Set which event conn is waiting for, POLLIN or POLLOUT. A freshly
+ * established connection waits for writability, once the negotiation
+ * was sent it waits for the reply; a TLS handshake may wait for either.
+ * check_poll builds its pollfd array from conn->watch, with epoll the
+ * connection is added or modified here.
+ *
+ * Parameters:
+ *    scanner: Scanner the connection belongs to
+ *    conn: Connection to (re)register
+ *    events: POLLIN or POLLOUT
+ * Return:
+ *    1 on success, 0 if epoll refused the descriptor. The connection
+ *    has then been closed with an OPM_ERR_WATCH error callback.
+ */
+static int
+libopm_do_watch(OPM_T *scanner, OPM_CONNECTION_T *conn, short events)
+{
+#ifdef HAVE_SYS_EPOLL_H
+  struct epoll_event ev;
+  const int op = conn->watch ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+#endif
+
+  if (conn->watch == events)
+    return 1;
+
+  conn->watch = events;
+
+#ifdef HAVE_SYS_EPOLL_H
+  if (scanner->epfd == -1)
+    return 1;
+
+  memset(&ev, 0, sizeof(ev));
+  ev.data.ptr = conn;
+  ev.events = events == POLLIN ? EPOLLIN : EPOLLOUT;
+
+  if (epoll_ctl(scanner->epfd, op, conn->fd, &ev) == -1)
+  {
+    libopm_do_callback(scanner, libopm_setup_remote(conn->scan->remote, conn), OPM_CALLBACK_ERROR, OPM_ERR_WATCH);
+    libopm_do_close(scanner, conn);
+    return 0;
+  }
+#endif
+  return 1;
 }
 
 /* check_poll
@@ -972,6 +1335,14 @@ libopm_check_poll(OPM_T *scanner)
   static unsigned int ufds_size;
   static struct pollfd *ufds = NULL;
 
+#ifdef HAVE_SYS_EPOLL_H
+  if (scanner->epfd > -1)
+  {
+    libopm_check_epoll(scanner);
+    return;
+  }
+#endif
+
   /* Grow pollfd array (ufds) as needed */
   if (ufds_size < (*(unsigned int *)libopm_config(scanner->config, OPM_CONFIG_FD_LIMIT)))
   {
@@ -988,7 +1359,7 @@ libopm_check_poll(OPM_T *scanner)
   {
     scan = node1->data;
 
-    LIST_FOREACH(node2, scan->connections->head)
+    LIST_FOREACH(node2, scan->connections.head)
     {
       if (size >= ufds_size)
         break;
@@ -1008,15 +1379,8 @@ libopm_check_poll(OPM_T *scanner)
       /* Check for INVALID FD */
       ufds[size].events |= POLLNVAL;
 
-      switch (conn->state)
-      {
-        case OPM_STATE_ESTABLISHED:
-          ufds[size].events |= POLLOUT;
-          break;
-        case OPM_STATE_NEGSENT:
-          ufds[size].events |= POLLIN;
-          break;
-      }
+      /* Whichever do_watch last asked for */
+      ufds[size].events |= conn->watch;
 
       size++;
     }
@@ -1038,7 +1402,7 @@ libopm_check_poll(OPM_T *scanner)
   {
     scan = node1->data;
 
-    LIST_FOREACH(node2, scan->connections->head)
+    LIST_FOREACH(node2, scan->connections.head)
     {
       conn = node2->data;
 
@@ -1058,145 +1422,190 @@ libopm_check_poll(OPM_T *scanner)
   }
 }
 
-static int
-libopm_do_readready_tls(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
+#ifdef HAVE_SYS_EPOLL_H
+/* check_epoll
+ *
+ * Collect ready connections from the scanner's epoll instance and
+ * dispatch them directly. Every established connection was registered
+ * once by do_connect, so no per-cycle descriptor array is rebuilt.
+ *
+ * Parameters:
+ *    scanner: Scanner to isolate check on
+ * Return:
+ *    None
+ */
+static void
+libopm_check_epoll(OPM_T *scanner)
 {
-#ifdef HAVE_LIBCRYPTO
-  int max_read, length;
-  char readbuf[LIBOPM_TLS_RECORD_SIZE];
-
-  if (!SSL_is_init_finished(conn->tls_handle))
-    return 0;
-
-  if ((length = SSL_read(conn->tls_handle, readbuf, sizeof(readbuf))) <= 0)
-  {
-    switch (SSL_get_error(conn->tls_handle, length))
-    {
-      /* TBD: possibly could recover here from some errors */ 
-      default:
-        libopm_do_hup(scanner, scan, conn);
-        return 0;
-    }
-  }
+  static unsigned int events_size;
+  static struct epoll_event *events = NULL;
+  unsigned int fd_limit;
+  int ready;
 
-  max_read = *(int *)libopm_config(scanner->config, OPM_CONFIG_MAX_READ);
+  fd_limit = *(unsigned int *)libopm_config(scanner->config, OPM_CONFIG_FD_LIMIT);
 
-  for (const char *p = readbuf, *end = readbuf + length; p < end; ++p)
+  /* Grow epoll_event array as needed */
+  if (events_size < fd_limit)
   {
-    conn->bytes_read++;
-
-    if (conn->bytes_read >= max_read)
-    {
-      libopm_do_callback(scanner, libopm_setup_remote(scan->remote, conn), OPM_CALLBACK_ERROR, OPM_ERR_MAX_READ);
-      conn->state = OPM_STATE_CLOSED;
-      return 0;
-    }
+    libopm_free(events);
 
-    if (*p == '\0' || *p == '\r')
-      continue;
+    events = libopm_calloc(sizeof(*events) * fd_limit);
+    events_size = fd_limit;
+  }
 
-    if (*p == '\n')
-    {
-      conn->readbuf[conn->readlen] = '\0';
-      conn->readlen = 0;
+  if (LIST_SIZE(scanner->scans) == 0 || events_size == 0)
+    return;
 
-      libopm_do_read(scanner, scan, conn);
+  ready = epoll_wait(scanner->epfd, events, events_size, 0);
 
-      if (conn->state == OPM_STATE_CLOSED)
-        return 0;
+  for (int i = 0; i < ready; ++i)
+  {
+    OPM_CONNECTION_T *conn = events[i].data.ptr;
 
+    /*
+     * Connections are only freed by check_closed, so conn is valid even
+     * if a callback for an earlier event has since closed it.
+     */
+    if (conn->state == OPM_STATE_CLOSED)
       continue;
-    }
 
-    if (conn->readlen < READBUFLEN)
-      conn->readbuf[++(conn->readlen) - 1] = *p;  /* -1 to pad for null term */
+    if (events[i].events & EPOLLIN)
+      libopm_do_readready(scanner, conn->scan, conn);
+    if ((events[i].events & EPOLLOUT) && conn->state != OPM_STATE_CLOSED)
+      libopm_do_writeready(scanner, conn->scan, conn);
+    if ((events[i].events & (EPOLLHUP | EPOLLERR)) && conn->state != OPM_STATE_CLOSED)
+      libopm_do_hup(scanner, conn->scan, conn);
   }
-#endif
-  return 0;
 }
+#endif
 
-/* do_readready
+/* do_readbuf
  *
- *    Remote connection is read ready, read the data into a buffer and check it against
- *    the target_string if neccessary
+ *    Account for a chunk of data received from the remote host and run it
+ *    through the target string matcher.
  *
  *    Parameters:
  *       scanner: Scanner doing the scan
  *       scan: Specific scan
  *       conn: Specific connection in the scan
+ *       buf: Data received
+ *       length: Number of bytes in buf
  *
  *    Return:
  *       None
  */
 static void
-libopm_do_readready(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
+libopm_do_readbuf(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn,
+                  const char *buf, size_t length)
 {
-  int max_read;
-  char c;
+  int max_read = *(int *)libopm_config(scanner->config, OPM_CONFIG_MAX_READ);
+  size_t room = 0;
+  int overflow;
 
-  /*
-   * If protocol has a specific read function, call that instead of
-   * reading data from here.
-   */
-  if (conn->protocol->read_function)
-  {
-    conn->protocol->read_function(scanner, scan, conn);
-    return;
-  }
+  /* Bytes that can be taken before conn->bytes_read reaches max_read */
+  if (max_read > conn->bytes_read + 1)
+    room = max_read - conn->bytes_read - 1;
 
-  max_read = *(int *)libopm_config(scanner->config, OPM_CONFIG_MAX_READ);
+  if ((overflow = length > room))
+    length = room;
 
-  while (1)
+  if (scanner->match)
   {
-    switch (read(conn->fd, &c, 1))
+    size_t used = libopm_acmatch_run(scanner->match, &conn->match_state, buf, length);
+
+    if (used)
     {
-      case 0:
-        libopm_do_hup(scanner, scan, conn);
-        return;
+      conn->bytes_read += used;
+      libopm_do_openproxy(scanner, scan, conn);
+      return;
+    }
+  }
 
-      case -1:
-        if (errno != EAGAIN)
-          libopm_do_hup(scanner, scan, conn);
-        return;
+  conn->bytes_read += length;
 
-      default:
-        conn->bytes_read++;
+  if (overflow)
+  {
+    conn->bytes_read++;
+    libopm_do_callback(scanner, libopm_setup_remote(scan->remote, conn), OPM_CALLBACK_ERROR, OPM_ERR_MAX_READ);
+    libopm_do_close(scanner, conn);
+  }
+}
 
-        if (conn->bytes_read >= max_read)
-        {
-          libopm_do_callback(scanner, libopm_setup_remote(scan->remote, conn), OPM_CALLBACK_ERROR, OPM_ERR_MAX_READ);
-          conn->state = OPM_STATE_CLOSED;
-          return;
-        }
+static int
+libopm_do_readready_tls(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
+{
+#ifdef HAVE_LIBCRYPTO
+  int length;
+  char readbuf[LIBOPM_TLS_RECORD_SIZE];
 
-        if (c == '\0' || c == '\r')
-          continue;
+  if (!SSL_is_init_finished(conn->tls_handle))
+  {
+    libopm_do_handshake(scanner, scan, conn);
+    return 0;
+  }
 
-        if (c == '\n')
-        {
-          conn->readbuf[conn->readlen] = '\0';
-          conn->readlen = 0;
+  if ((length = SSL_read(conn->tls_handle, readbuf, sizeof(readbuf))) <= 0)
+  {
+    switch (SSL_get_error(conn->tls_handle, length))
+    {
+      case SSL_ERROR_WANT_READ:
+        return 0;  /* No application data yet, e.g. only a TLS 1.3 session ticket */
+      /* TBD: possibly could recover here from some errors */ 
+      default:
+        libopm_do_hup(scanner, scan, conn);
+        return 0;
+    }
+  }
 
-          libopm_do_read(scanner, scan, conn);
+  libopm_do_readbuf(scanner, scan, conn, readbuf, length);
+#endif
+  return 0;
+}
 
-          if (conn->state == OPM_STATE_CLOSED)
-            return;
+/* do_handshake
+ *
+ *    Continue the TLS handshake of a connection. The handshake may be
+ *    blocked on reading as well as on writing, so the connection is made
+ *    to wait for whichever SSL_connect() asks for.
+ *
+ *    Parameters:
+ *       scanner: Scanner doing the scan
+ *       scan: Specific scan
+ *       conn: Specific connection in the scan
+ *
+ *    Return:
+ *       1 if the handshake is complete, 0 if it is still in progress or
+ *       failed. A failed connection has been closed.
+ */
+static int
+libopm_do_handshake(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
+{
+#ifdef HAVE_LIBCRYPTO
+  const int ret = SSL_connect(conn->tls_handle);
 
-          continue;
-        }
+  if (ret == 1)
+    return libopm_do_watch(scanner, conn, POLLOUT);  /* Ready to send the negotiation */
 
-        if (conn->readlen < READBUFLEN)
-          conn->readbuf[++(conn->readlen) - 1] = c;  /* -1 to pad for null term */
-    }
+  switch (SSL_get_error(conn->tls_handle, ret))
+  {
+    case SSL_ERROR_WANT_READ:
+      libopm_do_watch(scanner, conn, POLLIN);
+      break;
+    case SSL_ERROR_WANT_WRITE:
+      libopm_do_watch(scanner, conn, POLLOUT);
+      break;
+    default:
+      libopm_do_hup(scanner, scan, conn);
+      break;
   }
+#endif
+  return 0;
 }
 
-/* do_read
- *
- *    A line of data has been read from the socket, check it against
- *    target string.
- *
+/* do_readready
  *
+ *    Remote connection is read ready, read the data into a buffer and check it against
+ *    the target_string if neccessary
  *
  *    Parameters:
  *       scanner: Scanner doing the scan
@@ -1207,23 +1616,36 @@ libopm_do_readready(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
  *       None
  */
 static void
-libopm_do_read(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
+libopm_do_readready(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
 {
-  OPM_LIST_T *list;
-  OPM_NODE_T *node;
+  ssize_t length;
+  char readbuf[LIBOPM_READ_SIZE];
 
-  /* Check readbuf against target strings */
-  list = (OPM_LIST_T *)libopm_config(scanner->config, OPM_CONFIG_TARGET_STRING);
+  /*
+   * If protocol has a specific read function, call that instead of
+   * reading data from here.
+   */
+  if (conn->protocol->read_function)
+  {
+    conn->protocol->read_function(scanner, scan, conn);
+    return;
+  }
+
+  length = recv(conn->fd, readbuf, sizeof(readbuf), 0);
 
-  LIST_FOREACH(node, list->head)
+  switch (length)
   {
-    const char *target_string = node->data;
+    case 0:
+      libopm_do_hup(scanner, scan, conn);
+      return;
 
-    if (strstr(conn->readbuf, target_string))
-    {
-      libopm_do_openproxy(scanner, scan, conn);
-      break;
-    }
+    case -1:
+      if (errno != EAGAIN)
+        libopm_do_hup(scanner, scan, conn);
+      return;
+
+    default:
+      libopm_do_readbuf(scanner, scan, conn, readbuf, length);
   }
 }
 
@@ -1244,7 +1666,7 @@ static void
 libopm_do_openproxy(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
 {
   /* Mark the connection for close */
-  conn->state = OPM_STATE_CLOSED;
+  libopm_do_close(scanner, conn);
 
   /* Call client's open proxy callback */
   libopm_do_callback(scanner, libopm_setup_remote(scan->remote, conn), OPM_CALLBACK_OPENPROXY, 0);
@@ -1271,11 +1693,9 @@ libopm_do_writeready(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
 #ifdef HAVE_LIBCRYPTO
   if (conn->protocol->use_tls)
   {
-    if (!SSL_is_init_finished(conn->tls_handle))
-    {
-      SSL_connect(conn->tls_handle);
+    if (!SSL_is_init_finished(conn->tls_handle) &&
+        !libopm_do_handshake(scanner, scan, conn))
       return;
-    }
   }
 #endif
 
@@ -1287,6 +1707,9 @@ libopm_do_writeready(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
 
   /* Flag as NEGSENT so we don't have to send data again*/
   conn->state = OPM_STATE_NEGSENT;
+
+  /* From now on we are only interested in the reply */
+  libopm_do_watch(scanner, conn, POLLIN);
 }
 
 /* do_hup
@@ -1305,7 +1728,7 @@ static void
 libopm_do_hup(OPM_T *scanner, OPM_SCAN_T *scan, OPM_CONNECTION_T *conn)
 {
   /* Mark the connection for close */
-  conn->state = OPM_STATE_CLOSED;
+  libopm_do_close(scanner, conn);
 
   libopm_do_callback(scanner, libopm_setup_remote(scan->remote, conn), OPM_CALLBACK_NEGFAIL, 0);
 }
@@ -11,9 +11,11 @@
 #include "opm.h"
 
 #define CBLEN 5         /* Number of callback functions  */
-#define READBUFLEN 128  /* Size of conn->readbuf         */
+#define POOLLEN 2       /* Number of object pools        */
 #define SENDBUFLEN 512  /* Size of sendbuffer in proxy.c */
 #define LIBOPM_TLS_RECORD_SIZE 16384
+#define LIBOPM_READ_SIZE 4096  /* Bytes taken from a plain socket per recv() */
+#define LIBOPM_WHEEL_SIZE 64   /* Slots in the timeout wheel, one per second */
 
 typedef struct  _OPM_SCAN             OPM_SCAN_T;
 typedef struct  _OPM_CONNECTION       OPM_CONNECTION_T;
@@ -31,19 +33,25 @@ struct _OPM_SCAN
 {
   struct sockaddr_in   addr;           /* Address in byte order of remote client */
   OPM_REMOTE_T        *remote;         /* Pointed to the OPM_REMOTE_T for this scan, passed by client */
-  OPM_LIST_T          *connections;    /* List of individual connections of this scan (1 for each protocol) */
+  OPM_LIST_T           connections;    /* List of individual connections of this scan (1 for each protocol) */
+  OPM_NODE_T           node;           /* Links this scan into scanner->queue or scanner->scans */
 };
 
 struct _OPM_CONNECTION
 {
+  OPM_SCAN_T         *scan;            /* Scan this connection belongs to */
+  OPM_NODE_T          node;            /* Links this connection into scan->connections */
   OPM_PROTOCOL_T     *protocol;        /* Pointer to specific protocol this connection handles */
   unsigned short int  port;            /* Some protocols have multiple ports, eg. HTTP */
-  int                fd;               /* Allocated file descriptor, 0 if not yet allocated */
+  int                fd;               /* Allocated file descriptor, -1 if not yet allocated */
   unsigned short int bytes_read;       /* Bytes read so far in this connection */
-  char               readbuf[READBUFLEN + 1]; /* 128 byte read buffer, anything over 128 is probably not of use */
-  unsigned short int readlen;          /* Length of readbuf */
+  unsigned int       match_state;      /* State of the target string matcher */
   unsigned short int state;            /* State of connection */
+  short int          watch;            /* POLLIN or POLLOUT, whichever the connection waits for; 0 if neither */
   time_t             creation;         /* When this connection was established */
+  OPM_CONNECTION_T  *timer_next;       /* Links in the wheel slot or closed list this connection is on */
+  OPM_CONNECTION_T  *timer_prev;
+  OPM_CONNECTION_T **timer_list;       /* Head of that list, NULL if on none */
   void *tls_handle;                    /* SSL structure created by SSL_new() */
 };
 
@@ -29,7 +29,7 @@
 #define LIST_FOREACH(pos, head) for (pos = (head); pos != NULL; pos = pos->next)
 #define LIST_FOREACH_SAFE(pos, n, head) for (pos = (head), n = pos ? pos->next : NULL; pos != NULL; pos = n, n = pos ? pos->next : NULL)
 #define LIST_FOREACH_PREV(pos, head) for (pos = (head); pos != NULL; pos = pos->prev)
-#define LIST_SIZE(list) list->elements
+#define LIST_SIZE(list) (list)->elements
 
 extern OPM_NODE_T *libopm_node_create(void *);
 extern OPM_LIST_T *libopm_list_create(void);
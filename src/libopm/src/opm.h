@@ -7,12 +7,17 @@
 #ifndef OPM_H
 #define OPM_H
 
+#include <stdint.h>
+#include <time.h>
+
 #include "opm_common.h"
 
 typedef struct  _OPM_CONFIG           OPM_CONFIG_T;
 typedef struct  _OPM                  OPM_T;
 typedef struct  _OPM_REMOTE           OPM_REMOTE_T;
 typedef struct  _OPM_CALLBACK         OPM_CALLBACK_T;
+typedef struct  _OPM_POOL_STATS       OPM_POOL_STATS_T;
+typedef struct  _OPM_ADDR             OPM_ADDR_T;
 
 typedef         int                   OPM_ERR_T;
 
@@ -24,6 +29,20 @@ struct _OPM_CALLBACK
   void *data;
 };
 
+struct _OPM_POOL_STATS
+{
+  unsigned int used;                  /* Objects currently in use          */
+  unsigned int peak;                  /* Highest number ever in use at once */
+  unsigned int total;                 /* Objects allocated, used or free   */
+};
+
+struct _OPM_ADDR
+{
+  unsigned short int family;          /* AF_INET, AF_INET6, or 0 if not parsed  */
+  unsigned char bytes[16];            /* Address in network byte order, AF_INET
+                                         uses the first 4 bytes only            */
+};
+
 struct _OPM_CONFIG
 {
   void **vars;
@@ -36,12 +55,23 @@ struct _OPM
   OPM_LIST_T   *scans;                /* List of scans (each scan containing a list of connections) */
   OPM_LIST_T   *protocols;            /* List of protocols this scanner handles                     */
   unsigned int  fd_use;               /* Number of file descriptors in use                          */
+  int           epfd;                 /* epoll instance connections are registered with, or -1      */
   OPM_CALLBACK_T *callbacks;          /* Scanner wide callbacks                                     */
+  struct _OPM_POOL **pools;           /* Object pools for scans and connections                     */
+  struct _OPM_ACMATCH *match;         /* Compiled target strings, NULL if there are none            */
+  struct _OPM_CONNECTION **wheel;     /* Established connections by the second they time out        */
+  struct _OPM_CONNECTION *closed;     /* Closed connections waiting to be freed by check_closed     */
+  time_t        wheel_time;           /* Last second the wheel was advanced to                      */
+  time_t        present;              /* Time stamped once per opm_cycle()                          */
+  uint64_t      connect_credit;       /* Connects OPM_CONFIG_CONNECT_RATE allows now, in 1/1000ths  */
+  uint64_t      connect_time;         /* Monotonic milliseconds of the last credit refill           */
+  int           connect_wait;         /* Connections are waiting for credit                         */
 };
 
 struct _OPM_REMOTE
 {
   char                *ip;              /* Readable IP address                         */
+  OPM_ADDR_T           addr;            /* Binary form of ip, set by opm_scan          */
   unsigned short int   port;            /* Port passed back on certain callbacks       */
   unsigned short int   protocol;        /* Protocol passed back on certain callbacks   */
   unsigned short int   bytes_read;      /* Bytes read passed back on certain callbacks */
@@ -56,7 +86,9 @@ extern OPM_REMOTE_T *opm_remote_create(const char *);
 extern void opm_remote_free(OPM_REMOTE_T *);
 
 extern OPM_ERR_T opm_config(OPM_T *, int, const void *);
+extern OPM_ERR_T opm_addr_parse(OPM_ADDR_T *, const char *);
 extern OPM_ERR_T opm_scan(OPM_T *, OPM_REMOTE_T *);
+extern OPM_ERR_T opm_scan_addr(OPM_T *, OPM_REMOTE_T *, const OPM_ADDR_T *);
 extern void opm_end(OPM_T *, OPM_REMOTE_T *);
 extern void opm_endscan(OPM_T *, OPM_REMOTE_T *);
 
@@ -67,4 +99,7 @@ extern OPM_ERR_T opm_callback(OPM_T *, int, OPM_CALLBACK_FUNC *, void *);
 extern void opm_cycle(OPM_T *);
 
 extern size_t opm_active(OPM_T *);
+extern int opm_pollfd(OPM_T *);
+extern int opm_timeout(OPM_T *);
+extern OPM_ERR_T opm_pool_stats(OPM_T *, int, OPM_POOL_STATS_T *);
 #endif /* OPM_H */
@@ -22,5 +22,6 @@
 /* bind/connect errors */
 #define OPM_ERR_BIND              9  /* Error binding to BIND_IP */
 #define OPM_ERR_NOFD              10  /* Unable to allocate file descriptor */
+#define OPM_ERR_WATCH             11  /* Unable to watch file descriptor for events */
 
 #endif /* LIBOPM_ERROR_H */
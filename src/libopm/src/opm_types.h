@@ -10,6 +10,7 @@
 #define OPM_CONFIG_SCAN_PORT     5
 #define OPM_CONFIG_MAX_READ      6
 #define OPM_CONFIG_TIMEOUT       7
+#define OPM_CONFIG_CONNECT_RATE  8
 
 /* Configuration Variable Types */
 #define OPM_TYPE_INT             1
@@ -36,6 +37,11 @@
 #define OPM_STATE_CLOSED         4
 
 
+/* Object pools, see opm_pool_stats() */
+#define OPM_POOL_SCAN            0
+#define OPM_POOL_CONNECTION      1
+
+
 /*
  * Callbacks -- If more callback types are added, CBLEN will
  * need to be changed in libopm.h accordingly
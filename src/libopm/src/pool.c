@@ -0,0 +1,163 @@
+/*
+ *  Copyright (c) 2014-2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file pool.c
+ * \brief Fixed-size object pools.
+ * \version $Id$
+ *
+ * Scans, connections and their list nodes live for a few seconds each
+ * and are created at a high rate. Each scanner keeps a pool per type:
+ * objects are carved out of slabs and go on a free list when released,
+ * so they are reused instead of going back to the heap. Slabs are only
+ * returned when the scanner is freed.
+ */
+
+#include "setup.h"
+
+#include <string.h>
+
+#include "memory.h"
+#include "pool.h"
+
+
+/* Slabs and free objects start with a link to the next one */
+struct pool_link
+{
+  struct pool_link *next;
+};
+
+/* Round objects up so every one in a slab is suitably aligned */
+#define POOL_ALIGN (sizeof(void *) > sizeof(long double) ? sizeof(void *) : sizeof(long double))
+
+
+/* pool_create
+ *
+ *    Create a pool of objects of one size.
+ *
+ * Parameters:
+ *    size: Size of the objects
+ *    per_slab: Number of objects to allocate at once when the pool runs dry
+ *
+ * Return:
+ *    Address of the new pool
+ */
+OPM_POOL_T *
+libopm_pool_create(size_t size, unsigned int per_slab)
+{
+  OPM_POOL_T *ret = libopm_calloc(sizeof(*ret));
+
+  if (size < sizeof(struct pool_link))
+    size = sizeof(struct pool_link);
+
+  ret->size = (size + POOL_ALIGN - 1) / POOL_ALIGN * POOL_ALIGN;
+  ret->per_slab = per_slab;
+
+  return ret;
+}
+
+/* pool_free
+ *
+ *    Free a pool and every object in it, released or not.
+ *
+ * Parameters:
+ *    pool: Pool to free
+ *
+ * Return:
+ *    None
+ */
+void
+libopm_pool_free(OPM_POOL_T *pool)
+{
+  struct pool_link *slab = pool->slabs;
+
+  while (slab)
+  {
+    struct pool_link *next = slab->next;
+
+    libopm_free(slab);
+    slab = next;
+  }
+
+  libopm_free(pool);
+}
+
+/* pool_alloc
+ *
+ *    Take a zeroed object from the pool, growing it by a slab if no
+ *    released object is available.
+ *
+ * Parameters:
+ *    pool: Pool to allocate from
+ *
+ * Return:
+ *    Address of the object
+ */
+void *
+libopm_pool_alloc(OPM_POOL_T *pool)
+{
+  struct pool_link *obj;
+
+  if (pool->free == NULL)
+  {
+    struct pool_link *slab = libopm_calloc(POOL_ALIGN + pool->size * pool->per_slab);
+    char *p = (char *)slab + POOL_ALIGN;
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+
+    for (unsigned int i = 0; i < pool->per_slab; ++i, p += pool->size)
+    {
+      obj = (struct pool_link *)p;
+      obj->next = pool->free;
+      pool->free = obj;
+    }
+
+    pool->stats.total += pool->per_slab;
+  }
+
+  obj = pool->free;
+  pool->free = obj->next;
+
+  if (++pool->stats.used > pool->stats.peak)
+    pool->stats.peak = pool->stats.used;
+
+  memset(obj, 0, pool->size);
+  return obj;
+}
+
+/* pool_release
+ *
+ *    Give an object back to the pool it was taken from.
+ *
+ * Parameters:
+ *    pool: Pool the object belongs to
+ *    ptr: Object to release
+ *
+ * Return:
+ *    None
+ */
+void
+libopm_pool_release(OPM_POOL_T *pool, void *ptr)
+{
+  struct pool_link *obj = ptr;
+
+  obj->next = pool->free;
+  pool->free = obj;
+  pool->stats.used--;
+}
@@ -0,0 +1,47 @@
+/*
+ *  Copyright (c) 2014-2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file pool.h
+ * \brief A header for the fixed-size object pools.
+ * \version $Id$
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+
+#include "opm.h"
+
+typedef struct _OPM_POOL OPM_POOL_T;
+
+struct _OPM_POOL
+{
+  size_t        size;                  /* Size of one object, rounded up for alignment */
+  unsigned int  per_slab;              /* Objects carved out of each slab              */
+  void         *slabs;                 /* Slabs allocated so far, chained              */
+  void         *free;                  /* Objects ready for reuse, chained             */
+  OPM_POOL_STATS_T stats;
+};
+
+extern OPM_POOL_T *libopm_pool_create(size_t, unsigned int);
+extern void libopm_pool_free(OPM_POOL_T *);
+extern void *libopm_pool_alloc(OPM_POOL_T *);
+extern void libopm_pool_release(OPM_POOL_T *, void *);
+#endif /* POOL_H */
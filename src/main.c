@@ -32,22 +32,27 @@
 #include <string.h>
 
 #include "config.h"
+#include "event.h"
 #include "irc.h"
 #include "log.h"
 #include "opercmd.h"
 #include "scan.h"
+#include "dnsbl.h"
+#include "negcache.h"
 #include "options.h"
 #include "memory.h"
 #include "main.h"
 
 
 static int RESTART = 0;  /* Flagged to restart on next cycle */
-static int ALARMED = 0;  /* Flagged to call timer functions on next cycle */
 static int REOPEN  = 0;  /* Flagged to reopen log files on next cycle */
+static int RELOAD  = 0;  /* Flagged to reload blacklist zone files on next cycle */
+static int QUIT    = 0;  /* Signal to exit on next cycle, once state is saved */
 
-static struct sigaction ALARMACTION;
 static struct sigaction INTACTION;
+static struct sigaction TERMACTION;
 static struct sigaction USR1ACTION;
+static struct sigaction HUPACTION;
 
 static const char *CONFNAME = DEFAULTNAME;
 static const char *CONFDIR = HOPM_ETCDIR;
@@ -62,17 +67,16 @@ do_signal(int signum)
 {
   switch (signum)
   {
-    case SIGALRM:
-      ALARMED = 1;
-      alarm(1);
-      break;
     case SIGINT:
-      log_printf("MAIN -> Caught SIGINT, bye!");
-      exit(0);
+    case SIGTERM:
+      QUIT = signum;
       break;
     case SIGUSR1:
       REOPEN = 1;
       break;
+    case SIGHUP:
+      RELOAD = 1;
+      break;
   }
 }
 
@@ -172,20 +176,24 @@ main(int argc, char *argv[])
     exit(EXIT_FAILURE);
   }
 
-  /* Setup alarm & int handlers. */
-  ALARMACTION.sa_handler = &do_signal;
-  ALARMACTION.sa_flags = SA_RESTART;
+  /* Setup int handlers. */
   INTACTION.sa_handler = &do_signal;
+  TERMACTION.sa_handler = &do_signal;
   USR1ACTION.sa_handler = &do_signal;
+  HUPACTION.sa_handler = &do_signal;
 
-  sigaction(SIGALRM, &ALARMACTION, 0);
   sigaction(SIGINT, &INTACTION, 0);
+  sigaction(SIGTERM, &TERMACTION, 0);
   sigaction(SIGUSR1, &USR1ACTION, 0);
+  sigaction(SIGHUP, &HUPACTION, 0);
 
   /* Ignore SIGPIPE. */
   signal(SIGPIPE, SIG_IGN);
 
-  alarm(1);
+  /* 1 second timers */
+  event_timer_add(irc_timer, 1000);
+  event_timer_add(scan_timer, 1000);
+  event_timer_add(command_timer, 1000);
 
   while (1)
   {
@@ -193,9 +201,22 @@ main(int argc, char *argv[])
     irc_cycle();
     scan_cycle();
 
+    /* Sleep until a descriptor is ready or a timer is due */
+    event_wait();
+
+    if (QUIT)
+    {
+      log_printf("MAIN -> Caught %s, bye!", QUIT == SIGINT ? "SIGINT" : "SIGTERM");
+      negcache_save();
+      exit(0);
+    }
+
     /* Restart HOPM if main_restart() was called (usually happens by m_kill in irc.c) */
     if (RESTART)
     {
+      /* Let the new process start with the negative cache of this one */
+      negcache_save();
+
       /* If restarted in debug mode, die */
       if (OPT_DEBUG)
         return 1;
@@ -238,14 +259,12 @@ main(int argc, char *argv[])
       REOPEN = 0;
     }
 
-    /* Call 1 second timers */
-    if (ALARMED)
+    /* Check for blacklist zone file reload */
+    if (RELOAD)
     {
-      irc_timer();
-      scan_timer();
-      command_timer();
-
-      ALARMED = 0;
+      log_printf("MAIN -> Caught SIGHUP, reloading blacklist zone files");
+      dnsbl_zone_reload(1);
+      RELOAD = 0;
     }
   }
 
@@ -0,0 +1,276 @@
+/*
+ *  Copyright (c) 2014-2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file maskindex.c
+ * \brief Matching nick!user@host against many masks at once.
+ * \version $Id$
+ *
+ * Masks are sorted when the index is built. Nearly all of them only
+ * care about the host, which the nick and user part "*!*@" (or "*@")
+ * gives away, and then take one of three forms:
+ *
+ *   *!*@host.example.org    the host exactly
+ *   *!*@*.example.org       any host ending in ".example.org"
+ *   *!*@192.0.2.0/24        any address within the network
+ *
+ * The first two go into a trie of hosts spelled backwards, so a host
+ * is looked up in a single walk from its last character to its first,
+ * however many masks there are. Networks go into a patricia trie per
+ * address family and are looked up by address. Whatever else remains
+ * is tried with match(), one mask after another, as all of them used
+ * to be.
+ *
+ * Names given to mask_index_match() are nick!user@host, where neither
+ * nick nor user contain '@'; the host then is what follows the last
+ * '@', and matching it against the trie gives the same answer match()
+ * would for the whole name.
+ */
+
+#include "setup.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include "memory.h"
+#include "list.h"
+#include "match.h"
+#include "patricia.h"
+#include "maskindex.h"
+
+
+struct mask_trie
+{
+  struct mask_trie *child;  /* First node one character further in */
+  struct mask_trie *sibling;  /* Next node with the same parent */
+  unsigned char c;
+  unsigned char exact;  /* A mask ends here: the host is this */
+  unsigned char suffix;  /* A mask ends here: the host ends in this */
+};
+
+struct mask_index
+{
+  struct mask_trie hosts;  /* Root; hosts spelled backwards */
+  patricia_tree_t *networks4;  /* One per family, as patricia does not tell them apart */
+  patricia_tree_t *networks6;
+  list_t others;  /* char *, tried with match() */
+};
+
+
+/*
+ * Host part of a mask that only looks at the host, NULL for any other.
+ */
+static const char *
+mask_index_host(const char *mask)
+{
+  if (strncmp(mask, "*!*@", 4) == 0)
+    return mask + 4;
+  if (strncmp(mask, "*@", 2) == 0)
+    return mask + 2;
+  return NULL;
+}
+
+/*
+ * Add a network in address/bits form. Returns 0 if it is not one.
+ */
+static int
+mask_index_add_network(struct mask_index *idx, const char *host)
+{
+  unsigned char addr[16];
+  char buf[INET6_ADDRSTRLEN];
+  const char *slash = strchr(host, '/');
+  char *end;
+
+  if (slash == NULL || (size_t)(slash - host) >= sizeof(buf) || slash[1] == '\0')
+    return 0;
+
+  memcpy(buf, host, slash - host);
+  buf[slash - host] = '\0';
+
+  const int family = strchr(buf, ':') ? AF_INET6 : AF_INET;
+  const unsigned long bitlen = strtoul(slash + 1, &end, 10);
+
+  if (*end || bitlen > (family == AF_INET6 ? 128 : 32) || inet_pton(family, buf, addr) != 1)
+    return 0;
+
+  patricia_make_and_lookup_bits(family == AF_INET6 ? idx->networks6 : idx->networks4, family, addr, bitlen);
+  return 1;
+}
+
+/*
+ * Add a host, or with suffix set the end of one, to the trie.
+ */
+static void
+mask_index_add_host(struct mask_index *idx, const char *host, int suffix)
+{
+  struct mask_trie *node = &idx->hosts;
+
+  for (const char *p = host + strlen(host); p > host; )
+  {
+    const unsigned char c = match_tolower(*--p);
+    struct mask_trie *child;
+
+    for (child = node->child; child; child = child->sibling)
+      if (child->c == c)
+        break;
+
+    if (child == NULL)
+    {
+      child = xcalloc(sizeof(*child));
+      child->c = c;
+      child->sibling = node->child;
+      node->child = child;
+    }
+
+    node = child;
+  }
+
+  if (suffix)
+    node->suffix = 1;
+  else
+    node->exact = 1;
+}
+
+static void
+mask_index_add(struct mask_index *idx, const char *mask)
+{
+  const char *host = mask_index_host(mask);
+
+  if (host)
+  {
+    if (strpbrk(host, "*?\\") == NULL)
+    {
+      if (!mask_index_add_network(idx, host))
+        mask_index_add_host(idx, host, 0);
+      return;
+    }
+
+    if (*host == '*' && strpbrk(host + 1, "*?\\") == NULL)
+    {
+      mask_index_add_host(idx, host + 1, 1);
+      return;
+    }
+  }
+
+  list_add(&idx->others, node_create(xstrdup(mask)));
+}
+
+/*
+ * Build an index of a list of masks (char *). The list can be freed
+ * afterwards; the index keeps what it needs.
+ */
+struct mask_index *
+mask_index_create(const list_t *masks)
+{
+  struct mask_index *idx = xcalloc(sizeof(*idx));
+  node_t *node;
+
+  idx->networks4 = patricia_new(32);
+  idx->networks6 = patricia_new(128);
+
+  LIST_FOREACH(node, masks->head)
+    mask_index_add(idx, node->data);
+
+  return idx;
+}
+
+static void
+mask_index_free_trie(struct mask_trie *node)
+{
+  while (node)
+  {
+    struct mask_trie *next = node->sibling;
+
+    mask_index_free_trie(node->child);
+    xfree(node);
+    node = next;
+  }
+}
+
+void
+mask_index_free(struct mask_index *idx)
+{
+  node_t *node, *node_next;
+
+  if (idx == NULL)
+    return;
+
+  mask_index_free_trie(idx->hosts.child);
+  patricia_destroy(idx->networks4, NULL);
+  patricia_destroy(idx->networks6, NULL);
+
+  LIST_FOREACH_SAFE(node, node_next, idx->others.head)
+  {
+    xfree(node->data);
+    list_remove(&idx->others, node);
+    node_free(node);
+  }
+
+  xfree(idx);
+}
+
+/*
+ * Whether any mask of the index matches a nick!user@host name, or with
+ * addr given, takes in that address. Returns 1 if so, 0 otherwise.
+ */
+int
+mask_index_match(const struct mask_index *idx, const char *name, const OPM_ADDR_T *addr)
+{
+  const char *host = strrchr(name, '@');
+  node_t *node;
+
+  if (host)
+  {
+    const struct mask_trie *trie = &idx->hosts;
+    const char *p = name + strlen(name);
+
+    ++host;
+
+    while (trie)
+    {
+      if (trie->suffix)
+        return 1;
+
+      if (p == host)
+      {
+        if (trie->exact)
+          return 1;
+        break;
+      }
+
+      const unsigned char c = match_tolower(*--p);
+
+      for (trie = trie->child; trie; trie = trie->sibling)
+        if (trie->c == c)
+          break;
+    }
+  }
+
+  if (addr && (addr->family == AF_INET || addr->family == AF_INET6) &&
+      patricia_try_search_best_bytes(addr->family == AF_INET6 ? idx->networks6 : idx->networks4,
+                                     addr->family, addr->bytes))
+    return 1;
+
+  LIST_FOREACH(node, idx->others.head)
+    if (!match(node->data, name))
+      return 1;
+
+  return 0;
+}
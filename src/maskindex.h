@@ -0,0 +1,34 @@
+/*
+ *  Copyright (c) 2014-2017 ircd-hybrid development team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301
+ *  USA
+ */
+
+/*! \file maskindex.h
+ */
+
+#ifndef MASKINDEX_H
+#define MASKINDEX_H
+
+#include "list.h"
+#include "libopm/src/opm.h"
+
+struct mask_index;
+
+extern struct mask_index *mask_index_create(const list_t *);
+extern void mask_index_free(struct mask_index *);
+extern int mask_index_match(const struct mask_index *, const char *, const OPM_ADDR_T *);
+#endif
@@ -65,6 +65,16 @@ static const unsigned char ToLowerTab[] =
   0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
 };
 
+/*! \brief Fold the case of a character the way match() does.
+ * param c Character to fold.
+ * return Lower case of \a c, also mapping []\^ to {}|~.
+ */
+unsigned char
+match_tolower(unsigned char c)
+{
+  return ToLower(c);
+}
+
 /*! \brief Check a string against a mask.
  * This test checks using traditional IRC wildcards only: '*' means
  * match zero or more characters of any type; '?' means match exactly
@@ -30,4 +30,5 @@
 #define EmptyString(x) (!(x) || (*(x) == '\0'))
 
 extern int match(const char *, const char *);
+extern unsigned char match_tolower(unsigned char);
 #endif
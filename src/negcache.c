@@ -25,11 +25,29 @@
  * it is not scanned again.  Otherwise, the address is scanned as normal.  If
  * it is proven to be OK (i.e.  it doesn't run an open proxy) then it is added
  * to the trie.
+ *
+ * With negcache_backend = hash, addresses go to an open addressing hash
+ * table instead, which takes a fraction of the memory of the trie.
+ *
+ * What is cached is not the address itself but the network around it,
+ * negcache_ipv4_prefix and negcache_ipv6_prefix bits long, so a user
+ * who moves to another address of the same network (as IPv6 users do
+ * within their /64 all the time) is not scanned again either.
  */
 
 #include "setup.h"
 
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
 #include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 
 #include "list.h"
 #include "patricia.h"
@@ -39,88 +57,659 @@
 #include "log.h"
 
 
+/* Most expired entries dropped per call of negcache_expire() */
+#define NEGCACHE_EXPIRE_BUDGET 1024
+
+/* Slots a hash table starts with; it doubles when 3/4 are taken */
+#define NEGCACHE_HASH_SLOTS 1024
+
 extern unsigned int OPT_DEBUG;
 
+struct negcache_item
+{
+  node_t node;  /* In negcache_list */
+  patricia_node_t *pnode;
+  time_t seen;
+};
+
+/*
+ * Every entry of the tries, in the order they were last seen. All of
+ * them live for the same negcache time, so this is also the order in
+ * which they expire, the tail being the first. A patricia trie does
+ * not tell address families apart, so each has a trie of its own.
+ */
 static list_t negcache_list;
-static patricia_tree_t *negcache_trie;
+static patricia_tree_t *negcache_trie4;
+static patricia_tree_t *negcache_trie6;
+
+/*
+ * The hash table backend, one table per address family. A slot is the
+ * address followed by the 32 bit time it was last seen, 8 bytes for
+ * IPv4 and 20 for IPv6, against a patricia node, a prefix, an item and
+ * a list node per address in the trie. Slots with a zero time are
+ * empty. Collisions go to the next free slot (linear probing), and
+ * deleting an entry moves the ones after it back, so no tombstones are
+ * ever left behind. The table keeps no expiry order: negcache_expire()
+ * sweeps it a few slots at a time instead.
+ */
+struct negcache_hash
+{
+  unsigned char *slots;
+  size_t keylen;  /* Length of an address; a slot is 4 bytes more */
+  size_t mask;  /* Number of slots - 1, a power of 2 */
+  size_t elements;
+  size_t cursor;  /* Next slot the expiry sweep looks at */
+};
+
+static struct negcache_hash negcache_hash4 = { .keylen = 4 };
+static struct negcache_hash negcache_hash6 = { .keylen = 16 };
+static uint64_t negcache_hash_seed;
+
+static struct negcache_stats negcache_stats;
+
+/*
+ * Snapshot of the cache in negcache_file: a header, then one record per
+ * entry, oldest first if it comes from the trie. Both are laid out so
+ * the file can be used in place once mapped; the byte order marker
+ * rejects files written on a machine of another byte order. Bump
+ * NEGCACHE_FILE_VERSION whenever either struct changes.
+ */
+#define NEGCACHE_FILE_MAGIC "HOPMNEG"
+#define NEGCACHE_FILE_VERSION 1
+#define NEGCACHE_FILE_BYTEORDER 0x01020304
+
+struct negcache_file_header
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byteorder;
+  uint32_t count;  /* Records that follow */
+  uint32_t reclen;  /* sizeof(struct negcache_file_record) */
+};
+
+struct negcache_file_record
+{
+  int64_t seen;
+  uint8_t family;  /* 4 or 6; AF_INET6 differs between systems */
+  uint8_t bitlen;
+  uint8_t pad[6];
+  uint8_t addr[16];
+};
+
+static void negcache_load(void);
+
+
+/*
+ * Length of the networks cached for an address family, as configured
+ * or the whole address if that is out of range.
+ */
+static int
+negcache_prefix(int family)
+{
+  const int max = family == AF_INET6 ? 128 : 32;
+  const int bitlen = family == AF_INET6 ? OptionsItem->negcache_ipv6_prefix : OptionsItem->negcache_ipv4_prefix;
+
+  return bitlen > 0 && bitlen <= max ? bitlen : max;
+}
+
+/*
+ * Copy an address with every bit past the first bitlen cleared.
+ */
+static void
+negcache_mask(unsigned char *dst, const void *bytes, int family, int bitlen)
+{
+  const int len = family == AF_INET6 ? 16 : 4;
+
+  memcpy(dst, bytes, len);
 
+  for (int i = 0; i < len; ++i, bitlen -= 8)
+  {
+    if (bitlen <= 0)
+      dst[i] = 0;
+    else if (bitlen < 8)
+      dst[i] &= 0xff << (8 - bitlen);
+  }
+}
 
 /*
- * Initialise the patricia trie we use for storing our negative cache.
+ * Set up the trie or hash tables we use for storing our negative cache.
  */
 void
 negcache_init(void)
 {
-  if (negcache_trie)
+  if (negcache_trie4 || negcache_hash4.slots)
     /* Cache already exists */
     return;
 
-  negcache_trie = patricia_new(PATRICIA_MAXBITS);
+  if (OptionsItem->negcache_backend == NEGCACHE_BACKEND_HASH)
+  {
+    /* Seeded, so nobody can pick addresses that all land in one spot */
+    int fd = open("/dev/urandom", O_RDONLY);
+
+    if (fd == -1 || read(fd, &negcache_hash_seed, sizeof(negcache_hash_seed)) != sizeof(negcache_hash_seed))
+      negcache_hash_seed = ((uint64_t)time(NULL) << 32) ^ (uint64_t)getpid();
+
+    if (fd != -1)
+      close(fd);
+
+    negcache_hash4.slots = xcalloc(NEGCACHE_HASH_SLOTS * (negcache_hash4.keylen + sizeof(uint32_t)));
+    negcache_hash4.mask = NEGCACHE_HASH_SLOTS - 1;
+    negcache_hash6.slots = xcalloc(NEGCACHE_HASH_SLOTS * (negcache_hash6.keylen + sizeof(uint32_t)));
+    negcache_hash6.mask = NEGCACHE_HASH_SLOTS - 1;
+  }
+  else
+  {
+    negcache_trie4 = patricia_new(32);
+    negcache_trie6 = patricia_new(128);
+  }
+
+  if (OptionsItem->negcache_file)
+    negcache_load();
+}
+
+static unsigned char *
+negcache_hash_slot(const struct negcache_hash *h, size_t i)
+{
+  return h->slots + i * (h->keylen + sizeof(uint32_t));
+}
+
+static uint32_t
+negcache_hash_seen(const struct negcache_hash *h, const unsigned char *slot)
+{
+  uint32_t seen;
+
+  memcpy(&seen, slot + h->keylen, sizeof(seen));
+  return seen;
 }
 
 /*
- * Check whether an IP address is in our negative cache and was added
- * recently enough.  Return a pointer to its node if so, NULL otherwise.
+ * Whether an entry seen at the given time has expired. Times are kept
+ * in 32 bits, so the difference is taken modulo 2^32 as well.
  */
-struct negcache_item *
-negcache_check(const char *ipstr)
+static int
+negcache_hash_expired(uint32_t seen, time_t now)
 {
-  if (OptionsItem->negcache == 0)
-    return NULL;
+  return (uint32_t)now - seen > (uint32_t)OptionsItem->negcache;
+}
+
+/*
+ * Slot an address would be in if no other address had taken it first.
+ */
+static size_t
+negcache_hash_home(const struct negcache_hash *h, const void *key)
+{
+  const unsigned char *p = key;
+  uint64_t v = negcache_hash_seed;
+
+  for (size_t i = 0; i < h->keylen; i += sizeof(uint32_t))
+  {
+    uint32_t w;
+
+    memcpy(&w, p + i, sizeof(w));
+    v = (v ^ w) * UINT64_C(0x9e3779b97f4a7c15);
+    v ^= v >> 32;
+  }
+
+  v *= UINT64_C(0xbf58476d1ce4e5b9);
+  v ^= v >> 31;
+
+  return v & h->mask;
+}
+
+/*
+ * Slot holding the given address, or the empty slot it would go to.
+ */
+static size_t
+negcache_hash_find(const struct negcache_hash *h, const void *key)
+{
+  size_t i = negcache_hash_home(h, key);
+
+  while (negcache_hash_seen(h, negcache_hash_slot(h, i)))
+  {
+    if (memcmp(negcache_hash_slot(h, i), key, h->keylen) == 0)
+      break;
+
+    i = (i + 1) & h->mask;
+  }
+
+  return i;
+}
+
+/*
+ * Empty a slot, moving entries that probed past it back into the gap
+ * so every entry stays reachable from its home slot.
+ */
+static void
+negcache_hash_delete(struct negcache_hash *h, size_t i)
+{
+  const size_t slotlen = h->keylen + sizeof(uint32_t);
+
+  for (size_t j = (i + 1) & h->mask; negcache_hash_seen(h, negcache_hash_slot(h, j)); j = (j + 1) & h->mask)
+  {
+    const size_t home = negcache_hash_home(h, negcache_hash_slot(h, j));
+
+    /* Leave it if its home is cyclically within (i, j] */
+    if (i <= j ? (i < home && home <= j) : (i < home || home <= j))
+      continue;
+
+    memcpy(negcache_hash_slot(h, i), negcache_hash_slot(h, j), slotlen);
+    i = j;
+  }
+
+  memset(negcache_hash_slot(h, i), 0, slotlen);
+  --h->elements;
+}
+
+/*
+ * Double the number of slots, leaving out expired entries on the way.
+ */
+static void
+negcache_hash_grow(struct negcache_hash *h)
+{
+  const size_t slotlen = h->keylen + sizeof(uint32_t);
+  const time_t now = time(NULL);
+  unsigned char *old = h->slots;
+  const size_t oldslots = h->mask + 1;
+
+  h->mask = oldslots * 2 - 1;
+  h->slots = xcalloc((h->mask + 1) * slotlen);
+  h->elements = 0;
+  h->cursor = 0;
+
+  for (size_t i = 0; i < oldslots; ++i)
+  {
+    const unsigned char *slot = old + i * slotlen;
+    const uint32_t seen = negcache_hash_seen(h, slot);
+
+    if (seen == 0 || negcache_hash_expired(seen, now))
+      continue;
+
+    memcpy(negcache_hash_slot(h, negcache_hash_find(h, slot)), slot, slotlen);
+    ++h->elements;
+  }
+
+  xfree(old);
+
+  if (OPT_DEBUG)
+    log_printf("NEGCACHE -> Hash table for %zu byte addresses now has %zu slots, %zu in use",
+               h->keylen, h->mask + 1, h->elements);
+}
+
+/*
+ * Add an address to its hash table as seen at the given time, or
+ * refresh it if it is there already.
+ */
+static int
+negcache_hash_add(int family, const void *bytes, time_t seen)
+{
+  struct negcache_hash *h = family == AF_INET6 ? &negcache_hash6 : &negcache_hash4;
+
+  if ((uint32_t)seen == 0)
+    seen = 1;  /* Zero marks an empty slot */
+
+  if (h->elements + 1 > (h->mask + 1) / 4 * 3)
+    negcache_hash_grow(h);
+
+  unsigned char *slot = negcache_hash_slot(h, negcache_hash_find(h, bytes));
+  const uint32_t seen32 = seen;
+
+  if (negcache_hash_seen(h, slot) == 0)
+  {
+    memcpy(slot, bytes, h->keylen);
+    ++h->elements;
+  }
+
+  memcpy(slot + h->keylen, &seen32, sizeof(seen32));
+  return 1;
+}
+
+/*
+ * Add a prefix to the trie as seen at the given time, which must not be
+ * earlier than that of any entry already there. An entry that exists
+ * is refreshed and moves to the head of negcache_list. Returns 0 if the
+ * prefix is malformed.
+ */
+static int
+negcache_trie_add(int family, const void *bytes, int bitlen, time_t seen)
+{
+  patricia_tree_t *const tree = family == AF_INET6 ? negcache_trie6 : negcache_trie4;
+  patricia_node_t *pnode = patricia_make_and_lookup_bits(tree, family, bytes, bitlen);
+  if (!pnode)
+    return 0;  /* Malformed IP address */
+
+  struct negcache_item *n = pnode->data;
+  if (n)
+    list_remove(&negcache_list, &n->node);
+  else
+  {
+    n = xcalloc(sizeof(*n));
+    n->pnode = pnode;
+    n->node.data = n;
+    pnode->data = n;
+  }
+
+  n->seen = seen;
+  list_add(&negcache_list, &n->node);
+  return 1;
+}
 
-  patricia_node_t *pnode = patricia_try_search_exact(negcache_trie, ipstr);
+/*
+ * Add a network to the cache as seen at the given time. The trie takes
+ * networks of any length; the hash tables only hold networks of the
+ * configured length, so longer ones are cut down to it and shorter
+ * ones are refused. Returns 0 if it cannot be added.
+ */
+static int
+negcache_add(int family, const void *bytes, int bitlen, time_t seen)
+{
+  unsigned char masked[16];
+
+  if (negcache_trie4)
+  {
+    negcache_mask(masked, bytes, family, bitlen);
+    return negcache_trie_add(family, masked, bitlen, seen);
+  }
+
+  const int prefix = negcache_prefix(family);
+
+  if (bitlen < prefix)
+    return 0;
+
+  negcache_mask(masked, bytes, family, prefix);
+  return negcache_hash_add(family, masked, seen);
+}
+
+/*
+ * Load the snapshot left in negcache_file by negcache_save(), leaving
+ * out entries that expired meanwhile.
+ */
+static void
+negcache_load(void)
+{
+  const struct negcache_file_header *header;
+  const time_t now = time(NULL);
+  unsigned int loaded = 0;
+  struct stat st;
+  void *map;
+  int fd;
+
+  if ((fd = open(OptionsItem->negcache_file, O_RDONLY)) == -1)
+  {
+    if (errno != ENOENT)
+      log_printf("NEGCACHE -> Cannot read %s: %s", OptionsItem->negcache_file, strerror(errno));
+    return;
+  }
+
+  if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(*header) ||
+      (map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+  {
+    log_printf("NEGCACHE -> Cannot read %s", OptionsItem->negcache_file);
+    close(fd);
+    return;
+  }
+
+  header = map;
+
+  if (memcmp(header->magic, NEGCACHE_FILE_MAGIC, sizeof(header->magic)) ||
+      header->version != NEGCACHE_FILE_VERSION ||
+      header->byteorder != NEGCACHE_FILE_BYTEORDER ||
+      header->reclen != sizeof(struct negcache_file_record) ||
+      header->count > (st.st_size - sizeof(*header)) / sizeof(struct negcache_file_record))
+    log_printf("NEGCACHE -> Ignoring %s, it is not a snapshot of this version", OptionsItem->negcache_file);
+  else
+  {
+    const struct negcache_file_record *rec = (const void *)(header + 1);
+
+    for (uint32_t i = 0; i < header->count; ++i, ++rec)
+    {
+      const int family = rec->family == 6 ? AF_INET6 : AF_INET;
+
+      if ((rec->family != 4 || rec->bitlen > 32) && (rec->family != 6 || rec->bitlen > 128))
+        continue;
+
+      if (rec->seen > now || now - rec->seen > OptionsItem->negcache)
+        continue;
+
+      loaded += negcache_add(family, rec->addr, rec->bitlen, rec->seen);
+    }
+
+    log_printf("NEGCACHE -> Loaded %u of %u entries from %s", loaded, header->count,
+               OptionsItem->negcache_file);
+  }
+
+  munmap(map, st.st_size);
+  close(fd);
+}
+
+static void
+negcache_save_record(FILE *f, int family, const void *bytes, int bitlen, time_t seen)
+{
+  struct negcache_file_record rec;
+
+  memset(&rec, 0, sizeof(rec));
+  rec.seen = seen;
+  rec.family = family == AF_INET6 ? 6 : 4;
+  rec.bitlen = bitlen;
+  memcpy(rec.addr, bytes, family == AF_INET6 ? 16 : 4);
+
+  fwrite(&rec, sizeof(rec), 1, f);
+}
+
+static void
+negcache_save_hash(FILE *f, const struct negcache_hash *h, int family)
+{
+  for (size_t i = 0; i <= h->mask; ++i)
+  {
+    const unsigned char *slot = negcache_hash_slot(h, i);
+    const uint32_t seen = negcache_hash_seen(h, slot);
+
+    if (seen)
+      negcache_save_record(f, family, slot, negcache_prefix(family), seen);
+  }
+}
+
+/*
+ * Write the cache to negcache_file, so a restart does not start with
+ * an empty one. The snapshot goes to a temporary file first, which
+ * then replaces the old one, so a crash never leaves half a snapshot.
+ */
+void
+negcache_save(void)
+{
+  struct negcache_file_header header;
+  char tmp[PATH_MAX];
+  node_t *node;
+  FILE *f;
+
+  if ((negcache_trie4 == NULL && negcache_hash4.slots == NULL) || OptionsItem->negcache_file == NULL)
+    return;
+
+  snprintf(tmp, sizeof(tmp), "%s.tmp", OptionsItem->negcache_file);
+
+  if ((f = fopen(tmp, "wb")) == NULL)
+  {
+    log_printf("NEGCACHE -> Cannot write %s: %s", tmp, strerror(errno));
+    return;
+  }
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, NEGCACHE_FILE_MAGIC, sizeof(header.magic));
+  header.version = NEGCACHE_FILE_VERSION;
+  header.byteorder = NEGCACHE_FILE_BYTEORDER;
+  header.count = negcache_trie4 ? negcache_list.elements : negcache_hash4.elements + negcache_hash6.elements;
+  header.reclen = sizeof(struct negcache_file_record);
+
+  fwrite(&header, sizeof(header), 1, f);
+
+  if (negcache_trie4)
+  {
+    /* Oldest first, so loading it with list_add() keeps the order */
+    LIST_FOREACH_PREV(node, negcache_list.tail)
+    {
+      const struct negcache_item *n = node->data;
+      const prefix_t *prefix = n->pnode->prefix;
+
+      negcache_save_record(f, prefix->family, &prefix->add, prefix->bitlen, n->seen);
+    }
+  }
+  else
+  {
+    negcache_save_hash(f, &negcache_hash4, AF_INET);
+    negcache_save_hash(f, &negcache_hash6, AF_INET6);
+  }
+
+  const int error = ferror(f);
+
+  if (fclose(f) || error)
+  {
+    log_printf("NEGCACHE -> Cannot write %s: %s", tmp, strerror(errno));
+    unlink(tmp);
+    return;
+  }
+
+  if (rename(tmp, OptionsItem->negcache_file))
+  {
+    log_printf("NEGCACHE -> Cannot replace %s: %s", OptionsItem->negcache_file, strerror(errno));
+    unlink(tmp);
+    return;
+  }
+
+  if (OPT_DEBUG >= 2)
+    log_printf("NEGCACHE -> Saved %u entries to %s", header.count, OptionsItem->negcache_file);
+}
+
+static int
+negcache_lookup(const OPM_ADDR_T *addr)
+{
+  if (negcache_trie4 == NULL)
+  {
+    const struct negcache_hash *h = addr->family == AF_INET6 ? &negcache_hash6 : &negcache_hash4;
+    unsigned char masked[16];
+
+    negcache_mask(masked, addr->bytes, addr->family, negcache_prefix(addr->family));
+
+    const uint32_t seen = negcache_hash_seen(h, negcache_hash_slot(h, negcache_hash_find(h, masked)));
+
+    return seen && !negcache_hash_expired(seen, time(NULL));
+  }
+
+  /* The longest cached network the address is in */
+  patricia_tree_t *const tree = addr->family == AF_INET6 ? negcache_trie6 : negcache_trie4;
+  patricia_node_t *pnode = patricia_try_search_best_bytes(tree, addr->family, addr->bytes);
   if (pnode)
   {
     struct negcache_item *n = pnode->data;
 
     if (time(NULL) - n->seen <= OptionsItem->negcache)
-      return n;
+      return 1;
   }
 
-  return NULL;
+  return 0;
 }
 
 /*
- * Prepare an ASCII string representing an IPv4/IPv6 address for inserting into
- * our negative cache.
+ * Check whether an IP address is in a network of our negative cache
+ * that was added recently enough.  Return 1 if so, 0 otherwise.
  */
-void
-negcache_insert(const char *ipstr)
+int
+negcache_check(const OPM_ADDR_T *addr)
 {
-  patricia_node_t *pnode = patricia_make_and_lookup(negcache_trie, ipstr);
-  if (!pnode || pnode->data)
-    return;  /* Malformed IP address or already added to the trie */
+  if (OptionsItem->negcache == 0)
+    return 0;
+
+  const int hit = negcache_lookup(addr);
 
-  struct negcache_item *n = xcalloc(sizeof(*n));
-  n->seen = time(NULL);
+  if (addr->family == AF_INET6)
+    ++*(hit ? &negcache_stats.hit6 : &negcache_stats.miss6);
+  else
+    ++*(hit ? &negcache_stats.hit4 : &negcache_stats.miss4);
 
-  pnode->data = n;
-  list_add(&negcache_list, node_create(pnode));
+  return hit;
 }
 
 /*
- * Wrapper for recursive rebuild function.
+ * Insert the network of an IPv4/IPv6 address into our negative cache,
+ * or mark it as seen now if it is there already.
  */
 void
-negcache_rebuild(void)
+negcache_insert(const OPM_ADDR_T *addr)
 {
-  node_t *node, *node_next;
+  negcache_add(addr->family, addr->bytes, negcache_prefix(addr->family), time(NULL));
+}
+
+/*
+ * Fill in lookup counters and the current size and prefix lengths of
+ * the cache.
+ */
+void
+negcache_get_stats(struct negcache_stats *st)
+{
+  *st = negcache_stats;
+  st->entries = negcache_trie4 ? negcache_list.elements : negcache_hash4.elements + negcache_hash6.elements;
+  st->prefix4 = negcache_prefix(AF_INET);
+  st->prefix6 = negcache_prefix(AF_INET6);
+}
 
-  LIST_FOREACH_SAFE(node, node_next, negcache_list.head)
+/*
+ * Look at the next few slots of a hash table and drop what expired.
+ * Enough slots are looked at per call that the whole table is swept
+ * at least once per negcache time, at one call a second.
+ */
+static void
+negcache_hash_expire(struct negcache_hash *h, time_t now)
+{
+  size_t budget = (h->mask + 1) / (OptionsItem->negcache + 1) + 1;
+
+  if (budget < NEGCACHE_EXPIRE_BUDGET)
+    budget = NEGCACHE_EXPIRE_BUDGET;
+
+  for (; budget && h->elements; --budget)
   {
-    patricia_node_t *pnode = node->data;
-    struct negcache_item *n = pnode->data;
+    const uint32_t seen = negcache_hash_seen(h, negcache_hash_slot(h, h->cursor));
+
+    /* Deleting may move another entry into this slot, so stay on it */
+    if (seen && negcache_hash_expired(seen, now))
+      negcache_hash_delete(h, h->cursor);
+    else
+      h->cursor = (h->cursor + 1) & h->mask;
+  }
+}
+
+/*
+ * Drop entries that expired. With the trie they go oldest first and
+ * only the tail of negcache_list has to be looked at; to keep each
+ * call short, no more than NEGCACHE_EXPIRE_BUDGET entries go at once,
+ * and the rest is left for the next call.
+ */
+void
+negcache_expire(void)
+{
+  const time_t now = time(NULL);
 
-    if (n->seen + OptionsItem->negcache < time(NULL))
+  if (negcache_trie4 == NULL)
+  {
+    if (negcache_hash4.slots)
     {
-      if (OPT_DEBUG >= 2)
-        log_printf("NEGCACHE -> Deleting expired negcache node for %s added at %lu",
-                   patricia_prefix_toa(pnode->prefix, 0), n->seen);
-
-      list_remove(&negcache_list, node);
-      node_free(node);
-      xfree(n);
-      patricia_remove(negcache_trie, pnode);
+      negcache_hash_expire(&negcache_hash4, now);
+      negcache_hash_expire(&negcache_hash6, now);
     }
+
+    return;
+  }
+
+  for (unsigned int i = 0; i < NEGCACHE_EXPIRE_BUDGET && negcache_list.tail; ++i)
+  {
+    struct negcache_item *n = negcache_list.tail->data;
+
+    if (n->seen + OptionsItem->negcache >= now)
+      break;
+
+    if (OPT_DEBUG >= 2)
+      log_printf("NEGCACHE -> Deleting expired negcache node for %s added at %lu",
+                 patricia_prefix_toa(n->pnode->prefix, 0), n->seen);
+
+    list_remove(&negcache_list, &n->node);
+    patricia_remove(n->pnode->prefix->family == AF_INET6 ? negcache_trie6 : negcache_trie4, n->pnode);
+    xfree(n);
   }
 }
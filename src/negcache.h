@@ -21,13 +21,20 @@
 #ifndef NEGCACHE_H
 #define NEGCACHE_H
 
-struct negcache_item
+#include "libopm/src/opm.h"
+
+struct negcache_stats
 {
-  time_t seen;
+  unsigned int hit4, miss4;
+  unsigned int hit6, miss6;
+  size_t entries;
+  int prefix4, prefix6;
 };
 
 extern void negcache_init(void);
-extern struct negcache_item *negcache_check(const char *);
-extern void negcache_insert(const char *);
-extern void negcache_rebuild(void);
+extern int negcache_check(const OPM_ADDR_T *);
+extern void negcache_insert(const OPM_ADDR_T *);
+extern void negcache_expire(void);
+extern void negcache_save(void);
+extern void negcache_get_stats(struct negcache_stats *);
 #endif
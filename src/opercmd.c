@@ -83,6 +83,20 @@ cmd_fdstat(char *param, const char *target)
   fdstats_output(target);
 }
 
+/* cmd_dnsstat
+ *
+ *   Send how each nameserver has been answering to channel.
+ *
+ * Parameters:
+ *    param: Parameters of the command
+ *    target: channel command was sent to
+ */
+static void
+cmd_dnsstat(char *param, const char *target)
+{
+  dnsstats_output(target);
+}
+
 /* command_create
  *
  *    Create a Command struct.
@@ -152,10 +166,11 @@ command_parse(const char *command, const char *target, const char *source_p)
   char *param;  /* Parsed parameters */
   static const struct OperCommandHash COMMAND_TABLE[] =
   {
-    { .command = "CHECK",  .handler = cmd_check  },
-    { .command = "SCAN",   .handler = cmd_check  },
-    { .command = "STATS",  .handler = cmd_stats  },
-    { .command = "FDSTAT", .handler = cmd_fdstat },
+    { .command = "CHECK",   .handler = cmd_check   },
+    { .command = "SCAN",    .handler = cmd_check   },
+    { .command = "STATS",   .handler = cmd_stats   },
+    { .command = "FDSTAT",  .handler = cmd_fdstat  },
+    { .command = "DNSSTAT", .handler = cmd_dnsstat },
     { .command = NULL }
   };
 
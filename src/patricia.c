@@ -95,7 +95,7 @@ patricia_prefix_toa(const prefix_t *prefix, int with_len)
 }
 
 static prefix_t *
-New_Prefix2(int family, void *dest, int bitlen, prefix_t *prefix)
+New_Prefix2(int family, const void *dest, int bitlen, prefix_t *prefix)
 {
   int dynamic_allocated = 0;
   int addr_size = 0;
@@ -127,7 +127,7 @@ New_Prefix2(int family, void *dest, int bitlen, prefix_t *prefix)
 }
 
 static prefix_t *
-New_Prefix(int family, void *dest, int bitlen)
+New_Prefix(int family, const void *dest, int bitlen)
 {
   return New_Prefix2(family, dest, bitlen, NULL);
 }
@@ -974,4 +974,57 @@ patricia_try_search_best_addr(patricia_tree_t *tree, struct sockaddr *addr, int
 
   return NULL;
 }
+
+/*
+ * Exact search and insert of a full length address given as raw bytes
+ * in network order. The prefix lives on the stack, so neither parses
+ * nor allocates unless a node has to be created.
+ */
+patricia_node_t *
+patricia_try_search_exact_bytes(patricia_tree_t *tree, int family, const void *bytes)
+{
+  prefix_t prefix;
+
+  if (New_Prefix2(family, bytes, -1, &prefix) == NULL)
+    return NULL;
+
+  return patricia_search_exact(tree, &prefix);
+}
+
+patricia_node_t *
+patricia_make_and_lookup_bytes(patricia_tree_t *tree, int family, const void *bytes)
+{
+  prefix_t prefix;
+
+  if (New_Prefix2(family, bytes, -1, &prefix) == NULL)
+    return NULL;
+
+  return patricia_lookup(tree, &prefix);
+}
+
+/*
+ * Longest prefix match of a full length address given as raw bytes,
+ * and insert of a prefix of bitlen bits, both without parsing.
+ */
+patricia_node_t *
+patricia_try_search_best_bytes(patricia_tree_t *tree, int family, const void *bytes)
+{
+  prefix_t prefix;
+
+  if (New_Prefix2(family, bytes, -1, &prefix) == NULL)
+    return NULL;
+
+  return patricia_search_best(tree, &prefix);
+}
+
+patricia_node_t *
+patricia_make_and_lookup_bits(patricia_tree_t *tree, int family, const void *bytes, int bitlen)
+{
+  prefix_t prefix;
+
+  if (New_Prefix2(family, bytes, bitlen, &prefix) == NULL)
+    return NULL;
+
+  return patricia_lookup(tree, &prefix);
+}
 /* } */
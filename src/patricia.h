@@ -93,6 +93,10 @@ extern patricia_node_t *patricia_try_search_exact(patricia_tree_t *, const char
 extern patricia_node_t *patricia_try_search_best(patricia_tree_t *, const char *);
 extern patricia_node_t *patricia_try_search_exact_addr(patricia_tree_t *, struct sockaddr *, int);
 extern patricia_node_t *patricia_try_search_best_addr(patricia_tree_t *, struct sockaddr *, int);
+extern patricia_node_t *patricia_try_search_exact_bytes(patricia_tree_t *, int, const void *);
+extern patricia_node_t *patricia_make_and_lookup_bytes(patricia_tree_t *, int, const void *);
+extern patricia_node_t *patricia_try_search_best_bytes(patricia_tree_t *, int, const void *);
+extern patricia_node_t *patricia_make_and_lookup_bits(patricia_tree_t *, int, const void *, int);
 
 /* { from demo.c */
 extern patricia_node_t *patricia_make_and_lookup(patricia_tree_t *, const char *);
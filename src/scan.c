@@ -27,6 +27,8 @@
 #include <sys/socket.h>
 #include <netdb.h>
 #include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
 
 #include "compat.h"
 #include "config.h"
@@ -34,11 +36,13 @@
 #include "log.h"
 #include "stats.h"
 #include "dnsbl.h"
+#include "event.h"
+#include "firedns.h"
 #include "options.h"
 #include "negcache.h"
 #include "main.h"
 #include "memory.h"
-#include "match.h"
+#include "maskindex.h"
 #include "misc.h"
 #include "scan.h"
 
@@ -52,12 +56,31 @@
 /* GLOBAL LIST */
 static list_t SCANNERS;  /* List of OPM_T */
 
+/* Index of the exempt {} masks, built by scan_init() */
+static struct mask_index *EXEMPT_MASKS;
+
+/* Host name of a manual scan, while its A and AAAA queries are out */
+struct scan_resolve
+{
+  char *host;
+  char *scannername;
+  const char *target;
+  unsigned int pending;  /* Queries not answered yet */
+  int error;  /* firedns_errno of the last failed query */
+  int have4;
+  int have6;
+  struct in_addr addr4;
+  struct in6_addr addr6;
+};
+
 /* Function declarations */
-static struct scan_struct *scan_create(const char *[], const char *);
+static struct scan_struct *scan_create(const char *[], const char *, const OPM_ADDR_T *);
 static void scan_free(struct scan_struct *);
 static void scan_irckline(const struct scan_struct *, const char *, const char *);
 static void scan_negative(const struct scan_struct *);
 static void scan_log(OPM_REMOTE_T *);
+static void scan_manual_resolved(struct firedns_result *);
+static void scan_manual_start(int, const void *, const char *, const char *);
 
 /** Callbacks for LIBOPM */
 static void scan_open_proxy(OPM_T *, OPM_REMOTE_T *, int, void *);
@@ -69,6 +92,19 @@ static void scan_handle_error(OPM_T *, OPM_REMOTE_T *, int, void *);
 extern FILE *scanlogfile;
 
 
+/* scan_event
+ *
+ *    Called from event_wait() when IO is ready on a scanner's connections.
+ *    Waiting on the descriptor is all that is needed: event_wait() then
+ *    returns, and the next scan_cycle() runs opm_cycle() for every
+ *    scanner, which it must do anyway to start queued scans and expire
+ *    timed out connections.
+ */
+static void
+scan_event(int fd, short revents, void *data)
+{
+}
+
 /* scan_cycle
  *
  *    Perform scanner tasks.
@@ -85,7 +121,18 @@ scan_cycle(void)
   LIST_FOREACH(node, SCANNERS.head)
   {
     struct scanner_struct *scs = node->data;
+    int fd, timeout;
+
     opm_cycle(scs->scanner);
+
+    if ((fd = opm_pollfd(scs->scanner)) > -1)
+      event_fd(fd, POLLIN, scan_event, scs);
+    else if (opm_active(scs->scanner))
+      event_timeout(50);  /* No descriptor to wait on, come back shortly */
+
+    /* Come back when connect_rate allows the next connections */
+    if ((timeout = opm_timeout(scs->scanner)) > -1)
+      event_timeout(timeout);
   }
 }
 
@@ -100,22 +147,52 @@ scan_cycle(void)
 void
 scan_timer(void)
 {
-  static time_t nc_counter;
+  static time_t nc_snapshot;
 
   if (OptionsItem->negcache)
   {
-    if (nc_counter++ >= OptionsItem->negcache_rebuild)
-    {
-      /*
-       * Time to rebuild the negative cache.
-       */
-      if (OPT_DEBUG)
-        log_printf("SCAN -> Rebuilding negative cache");
+    negcache_expire();
 
-      negcache_rebuild();
-      nc_counter = 0;
+    if (OptionsItem->negcache_snapshot && ++nc_snapshot >= OptionsItem->negcache_snapshot)
+    {
+      negcache_save();
+      nc_snapshot = 0;
     }
   }
+
+  dnsbl_timer();
+}
+
+/* scan_fdstats
+ *
+ *    Output descriptor and object pool usage of each scanner to target
+ *    via privmsg.
+ *
+ * Parameters:
+ *    target: Channel or nick to send the stats to
+ *
+ * Return: NONE
+ */
+void
+scan_fdstats(const char *target)
+{
+  node_t *node;
+
+  LIST_FOREACH(node, SCANNERS.head)
+  {
+    const struct scanner_struct *scs = node->data;
+    OPM_POOL_STATS_T scans, conns;
+
+    opm_pool_stats(scs->scanner, OPM_POOL_SCAN, &scans);
+    opm_pool_stats(scs->scanner, OPM_POOL_CONNECTION, &conns);
+
+    irc_send("PRIVMSG %s :Scanner [%s]: %u FD in use, %zu scans", target,
+             scs->name, scs->scanner->fd_use, opm_active(scs->scanner));
+    irc_send("PRIVMSG %s :Scanner [%s]: scans %u used/%u peak/%u allocated, "
+             "connections %u/%u/%u", target, scs->name,
+             scans.used, scans.peak, scans.total,
+             conns.used, conns.peak, conns.total);
+  }
 }
 
 /* scan_gettype(int protocol)
@@ -161,25 +238,17 @@ scan_gettype(int protocol)
  *
  * Parameters:
  *     mask: Mask to check
+ *     ipmask: Mask with the IP address in place of the host
+ *     addr: IP address, for masks of a network
  *
  * Return:
  *     1 if mask is in list
  *     0 if mask is not in list
  */
 static int
-scan_checkexempt(const char *mask, const char *ipmask)
+scan_checkexempt(const char *mask, const char *ipmask, const OPM_ADDR_T *addr)
 {
-  node_t *node;
-
-  LIST_FOREACH(node, ExemptItem->masks->head)
-  {
-    const char *exempt_mask = node->data;
-
-    if (!match(exempt_mask, mask) || !match(exempt_mask, ipmask))
-      return 1;
-  }
-
-  return 0;
+  return mask_index_match(EXEMPT_MASKS, mask, addr) || mask_index_match(EXEMPT_MASKS, ipmask, NULL);
 }
 
 /* scan_init
@@ -209,7 +278,6 @@ scan_init(void)
     struct scanner_struct *scs = xcalloc(sizeof(*scs));
     scs->scanner = opm_create();
     scs->name = xstrdup(sc->name);
-    scs->masks = list_create();
 
     /* Setup configuration */
     opm_config(scs->scanner, OPM_CONFIG_FD_LIMIT, &sc->fd);
@@ -217,6 +285,7 @@ scan_init(void)
     opm_config(scs->scanner, OPM_CONFIG_SCAN_PORT, &sc->target_port);
     opm_config(scs->scanner, OPM_CONFIG_TIMEOUT, &sc->timeout);
     opm_config(scs->scanner, OPM_CONFIG_MAX_READ, &sc->max_read);
+    opm_config(scs->scanner, OPM_CONFIG_CONNECT_RATE, &sc->connect_rate);
     opm_config(scs->scanner, OPM_CONFIG_BIND_IP, sc->vhost);
 
     /* add target strings */
@@ -248,10 +317,11 @@ scan_init(void)
     list_add(&SCANNERS, node);
   }
 
-  /* Give scanners a list of masks they scan */
+  /* Give scanners an index of the masks they scan */
   LIST_FOREACH(p, SCANNERS.head)
   {
     struct scanner_struct *scs = p->data;
+    list_t masks = { NULL, NULL, 0 };
 
     LIST_FOREACH(p2, UserItemList->head)
     {
@@ -271,16 +341,26 @@ scan_init(void)
             if (OPT_DEBUG)
               log_printf("SCAN -> Linking the mask [%s] to scanner [%s]", mask, scannername);
 
-            node = node_create(xstrdup(mask));
-            list_add(scs->masks, node);
+            list_add(&masks, node_create(p4->data));
           }
 
           break;
         }
       }
     }
+
+    scs->masks = mask_index_create(&masks);
+
+    while (masks.head)
+      node_free(list_remove(&masks, masks.head));
   }
 
+  /* Build the new exempt index before the old one goes */
+  struct mask_index *exempt = mask_index_create(ExemptItem->masks);
+
+  mask_index_free(EXEMPT_MASKS);
+  EXEMPT_MASKS = exempt;
+
   /* Initialise negative cache */
   if (OptionsItem->negcache)
   {
@@ -309,8 +389,9 @@ scan_init(void)
 void
 scan_connect(const char *user[], const char *msg)
 {
-  node_t *p, *p2;
+  node_t *p;
   int ret;
+  unsigned int checked = 0;
 
   /*
    * Have to use MSGLENMAX here because it is unknown what the max size of
@@ -319,9 +400,16 @@ scan_connect(const char *user[], const char *msg)
    */
   char hostmask[MSGLENMAX];
   char addrmask[MSGLENMAX];
+  OPM_ADDR_T addr;
+
+  /*
+   * Parse the IP once, everything below works on the binary form. A
+   * malformed IP leaves addr.family 0, which no lookup matches.
+   */
+  opm_addr_parse(&addr, user[3]);
 
   /* Check negcache before anything */
-  if (negcache_check(user[3]))
+  if (negcache_check(&addr))
   {
     if (OPT_DEBUG)
       log_printf("SCAN -> %s!%s@%s [%s] is negatively cached. Skipping all tests.",
@@ -334,7 +422,7 @@ scan_connect(const char *user[], const char *msg)
   snprintf(addrmask, sizeof(addrmask), "%s!%s@%s", user[0], user[1], user[3]);
 
   /* Check exempt list now that we have a mask */
-  if (scan_checkexempt(hostmask, addrmask))
+  if (scan_checkexempt(hostmask, addrmask, &addr))
   {
     if (OPT_DEBUG)
       log_printf("SCAN -> %s [%s] is exempt from scanning", hostmask, user[3]);
@@ -343,56 +431,58 @@ scan_connect(const char *user[], const char *msg)
   }
 
   /* Create scan_struct */
-  struct scan_struct *ss = scan_create(user, msg);
+  struct scan_struct *ss = scan_create(user, msg, &addr);
 
   /* Store ss in the remote struct, so that in callbacks we have ss */
   ss->remote->data = ss;
 
+  /* Cached DNSBL answers complete right away; keep ss until we are done */
+  ++ss->scans;
+
   /* Start checking our DNSBLs */
   if (LIST_SIZE(OpmItem->blacklists))
-    dnsbl_add(ss);
+    checked = dnsbl_add(ss);
 
   /* Add ss->remote to all matching scanners */
   LIST_FOREACH(p, SCANNERS.head)
   {
     struct scanner_struct *scs = p->data;
 
-    LIST_FOREACH(p2, scs->masks->head)
+    if (ss->positive)
+      break;  /* Already listed in a cached DNSBL answer */
+
+    if (mask_index_match(scs->masks, hostmask, &ss->addr))
     {
-      const char *scsmask = p2->data;
+      if (OPT_DEBUG)
+        log_printf("SCAN -> Passing %s to scanner [%s]", hostmask, scs->name);
 
-      if (!match(scsmask, hostmask))
+      if ((ret = opm_scan_addr(scs->scanner, ss->remote, &ss->addr)) != OPM_SUCCESS)
       {
-        if (OPT_DEBUG)
-          log_printf("SCAN -> Passing %s to scanner [%s]", hostmask, scs->name);
-
-        if ((ret = opm_scan(scs->scanner, ss->remote)) != OPM_SUCCESS)
+        switch (ret)
         {
-          switch (ret)
-          {
-            case OPM_ERR_NOPROTOCOLS:
-              continue;
-              break;
-            case OPM_ERR_BADADDR:
-              if (!strchr(ss->ip, ':'))  /* XXX: hack alert. remove when libopm can deal with IPv6 addresses */
-                log_printf("OPM -> Bad address %s [%s]", ss->ip, scs->name);
-              break;
-            default:
-              log_printf("OPM -> Unknown error %s [%s]", ss->ip, scs->name);
-              break;
-          }
+          case OPM_ERR_NOPROTOCOLS:
+            break;
+          case OPM_ERR_BADADDR:
+            if (ss->addr.family != AF_INET6)  /* libopm does not scan IPv6 addresses */
+              log_printf("OPM -> Bad address %s [%s]", ss->ip, scs->name);
+            break;
+          default:
+            log_printf("OPM -> Unknown error %s [%s]", ss->ip, scs->name);
+            break;
         }
-        else
-          ++ss->scans;  /* Increase scan count only if OPM_SUCCESS */
-
-        break;  /* Continue to next scanner */
       }
+      else
+        ++ss->scans;  /* Increase scan count only if OPM_SUCCESS */
     }
   }
 
+  --ss->scans;
+
   /* All scanners returned !OPM_SUCCESS and there were no dnsbl checks */
-  if (ss->scans == 0)
+  if (ss->scans == 0 && checked == 0)
     scan_free(ss);
+  else
+    scan_checkfinished(ss);  /* All DNSBL answers may have been cached */
 }
 
 /* scan_create
@@ -407,12 +497,13 @@ scan_connect(const char *user[], const char *msg)
  *          user[2] = connecting users hostname
  *          user[3] = connecting users IP
  *          msg     = Original connect notice (used as PROOF)
+ *    addr: user[3] in binary form
  *
  * Return: Pointer to new scan_struct
  *
  */
 static struct scan_struct *
-scan_create(const char *user[], const char *msg)
+scan_create(const char *user[], const char *msg, const OPM_ADDR_T *addr)
 {
   struct scan_struct *ss = xcalloc(sizeof(*ss));
 
@@ -420,6 +511,7 @@ scan_create(const char *user[], const char *msg)
   ss->irc_username = xstrdup(user[1]);
   ss->irc_hostname = xstrdup(user[2]);
   ss->ip = xstrdup(user[3]);
+  ss->addr = *addr;
   ss->proof = xstrdup(msg);
   ss->remote = opm_remote_create(ss->ip);
 
@@ -688,6 +780,17 @@ scan_handle_error(OPM_T *scanner, OPM_REMOTE_T *remote, int err, void *data)
                  ss->manual_target, remote->ip, remote->port,
                  scan_gettype(remote->protocol), scs->name);
       break;
+    case OPM_ERR_WATCH:
+      log_printf("SCAN -> Unable to watch file descriptor for events %s:%d "
+                 "(%s) [%s]", remote->ip, remote->port,
+                 scan_gettype(remote->protocol), scs->name);
+
+      if (ss->manual_target)
+        irc_send("PRIVMSG %s :CHECK -> Scan failed %s:%d (%s) [%s] "
+                 "(unable to watch file descriptor)",
+                 ss->manual_target, remote->ip, remote->port,
+                 scan_gettype(remote->protocol), scs->name);
+      break;
     default:  /* Unknown Error! */
       if (OPT_DEBUG)
         log_printf("SCAN -> Unknown error %s:%d (%s) [%s]", remote->ip,
@@ -715,7 +818,7 @@ scan_negative(const struct scan_struct *ss)
     if (OPT_DEBUG >= 2)
       log_printf("SCAN -> Adding %s to negative cache", ss->ip);
 
-    negcache_insert(ss->ip);
+    negcache_insert(&ss->addr);
   }
 }
 
@@ -813,19 +916,17 @@ scan_irckline(const struct scan_struct *ss, const char *format, const char *type
 /* scan_manual
  *
  *    Create a manual scan. A manual scan is a scan where the
- *    scan_struct contains a manual_target pointer.
+ *    scan_struct contains a manual_target pointer. Host names are
+ *    resolved without blocking; the scan starts once both the A and
+ *    the AAAA query have been answered.
  */
 void
 scan_manual(char *param, const char *target)
 {
-  char buf[INET6_ADDRSTRLEN];
-  const void *addr = NULL;
+  struct in_addr addr4;
+  struct in6_addr addr6;
   const char *ip = NULL;
   char *scannername;
-  node_t *node;
-  int ret, n;
-  struct sockaddr_storage storage;
-  socklen_t storage_len = 0;
 
   /* If there were no parameters sent, simply alert the user and return */
   if (param == NULL)
@@ -846,9 +947,114 @@ scan_manual(char *param, const char *target)
     scannername++;
   }
 
+  if (inet_pton(AF_INET6, ip, &addr6) > 0)
+  {
+    scan_manual_start(AF_INET6, &addr6, scannername, target);
+    return;
+  }
+
+  if (inet_pton(AF_INET, ip, &addr4) > 0)
+  {
+    scan_manual_start(AF_INET, &addr4, scannername, target);
+    return;
+  }
+
+  struct scan_resolve *sr = xcalloc(sizeof(*sr));
+  sr->host = xstrdup(ip);
+  sr->scannername = scannername ? xstrdup(scannername) : NULL;
+  sr->target = target;
+
+  /* Ask for both address families at once; queries deferred by dns_fdlimit still answer */
+  if (firedns_getip(FDNS_QRY_AAAA, ip, scan_manual_resolved, sr) == 0 || firedns_errno == FDNS_ERR_FDLIMIT)
+    ++sr->pending;
+  else
+    sr->error = firedns_errno;
+
+  if (firedns_getip(FDNS_QRY_A, ip, scan_manual_resolved, sr) == 0 || firedns_errno == FDNS_ERR_FDLIMIT)
+    ++sr->pending;
+  else
+    sr->error = firedns_errno;
+
+  if (sr->pending == 0)
+  {
+    irc_send("PRIVMSG %s :CHECK -> Error resolving host '%s': %s",
+             target, sr->host, firedns_strerror(sr->error));
+    xfree(sr->scannername);
+    xfree(sr->host);
+    xfree(sr);
+  }
+}
+
+/* scan_manual_resolved
+ *
+ *    Callback for the A and AAAA queries of scan_manual(). Once both
+ *    are done, the scan is started on the IPv6 address if there is
+ *    one, otherwise on the IPv4 address.
+ *
+ * Parameters:
+ *    res: Result of the query, with the scan_resolve in info
+ */
+static void
+scan_manual_resolved(struct firedns_result *res)
+{
+  struct scan_resolve *sr = res->info;
+
+  if (firedns_errno == FDNS_ERR_NONE)
+  {
+    if (res->type == FDNS_QRY_AAAA)
+    {
+      memcpy(&sr->addr6, res->text, sizeof(sr->addr6));
+      sr->have6 = 1;
+    }
+    else
+    {
+      memcpy(&sr->addr4, res->text, sizeof(sr->addr4));
+      sr->have4 = 1;
+    }
+  }
+  else
+    sr->error = firedns_errno;
+
+  if (--sr->pending)
+    return;
+
+  if (sr->have6)
+    scan_manual_start(AF_INET6, &sr->addr6, sr->scannername, sr->target);
+  else if (sr->have4)
+    scan_manual_start(AF_INET, &sr->addr4, sr->scannername, sr->target);
+  else
+    irc_send("PRIVMSG %s :CHECK -> Error resolving host '%s': %s",
+             sr->target, sr->host, firedns_strerror(sr->error));
+
+  xfree(sr->scannername);
+  xfree(sr->host);
+  xfree(sr);
+}
+
+/* scan_manual_start
+ *
+ *    Start a manual scan on a resolved address.
+ *
+ * Parameters:
+ *    family: AF_INET or AF_INET6
+ *    addr: struct in_addr or struct in6_addr to scan
+ *    scannername: Only scanner to use, or NULL for all of them
+ *    target: Channel to report to
+ */
+static void
+scan_manual_start(int family, const void *addr, const char *scannername, const char *target)
+{
+  char buf[INET6_ADDRSTRLEN];
+  const char *ip = NULL;
+  node_t *node;
+  int ret, n;
+  unsigned int checked = 0;
+  struct sockaddr_storage storage;
+  socklen_t storage_len = 0;
+
   memset(&storage, 0, sizeof(storage));
 
-  if ((addr = firedns_resolveip6(ip)))
+  if (family == AF_INET6)
   {
     struct sockaddr_in6 *in = (struct sockaddr_in6 *)&storage;
 
@@ -856,7 +1062,7 @@ scan_manual(char *param, const char *target)
     storage.ss_family = AF_INET6;
     memcpy(&in->sin6_addr, addr, sizeof(in->sin6_addr));
   }
-  else if ((addr = firedns_resolveip4(ip)))
+  else
   {
     struct sockaddr_in *in = (struct sockaddr_in *)&storage;
 
@@ -864,12 +1070,6 @@ scan_manual(char *param, const char *target)
     storage.ss_family = AF_INET;
     memcpy(&in->sin_addr, addr, sizeof(in->sin_addr));
   }
-  else
-  {
-    irc_send("PRIVMSG %s :CHECK -> Error resolving host '%s': %s",
-             target, ip, firedns_strerror(firedns_errno));
-    return;
-  }
 
   if ((n = getnameinfo((const struct sockaddr *)&storage, storage_len, buf, sizeof(buf), NULL, 0, NI_NUMERICHOST)))
   {
@@ -882,6 +1082,8 @@ scan_manual(char *param, const char *target)
 
   struct scan_struct *ss = xcalloc(sizeof(*ss));
   ss->ip = xstrdup(ip);
+  ss->addr.family = storage.ss_family;
+  memcpy(ss->addr.bytes, addr, storage.ss_family == AF_INET6 ? 16 : 4);
   ss->remote = opm_remote_create(ss->ip);
   ss->remote->data = ss;
   ss->manual_target = target;
@@ -893,8 +1095,11 @@ scan_manual(char *param, const char *target)
     irc_send("PRIVMSG %s :CHECK -> Checking '%s' for open proxies on all scanners",
              target, ss->ip);
 
+  /* Cached DNSBL answers complete right away; keep ss until we are done */
+  ++ss->scans;
+
   if (LIST_SIZE(OpmItem->blacklists))
-    dnsbl_add(ss);
+    checked = dnsbl_add(ss);
 
   /* Add ss->remote to all scanners */
   LIST_FOREACH(node, SCANNERS.head)
@@ -912,14 +1117,14 @@ scan_manual(char *param, const char *target)
     if (OPT_DEBUG)
       log_printf("SCAN -> Passing %s to scanner [%s] (MANUAL SCAN)", ss->ip, scs->name);
 
-    if ((ret = opm_scan(scs->scanner, ss->remote)) != OPM_SUCCESS)
+    if ((ret = opm_scan_addr(scs->scanner, ss->remote, &ss->addr)) != OPM_SUCCESS)
     {
       switch (ret)
       {
         case OPM_ERR_NOPROTOCOLS:
           break;
         case OPM_ERR_BADADDR:
-          if (!strchr(ss->ip, ':'))  /* XXX: hack alert. remove when libopm can deal with IPv6 addresses */
+          if (ss->addr.family != AF_INET6)  /* libopm does not scan IPv6 addresses */
             irc_send("PRIVMSG %s :OPM -> Bad address %s [%s]",
                      ss->manual_target, ss->ip, scs->name);
           break;
@@ -933,11 +1138,13 @@ scan_manual(char *param, const char *target)
       ++ss->scans;  /* Increase scan count only if OPM_SUCCESS */
   }
 
+  --ss->scans;
+
   /*
    * If all of the scanners gave !OPM_SUCCESS and there were no dnsbl checks,
    * cleanup here
    */
-  if (ss->scans == 0)
+  if (ss->scans == 0 && checked == 0)
   {
     if (scannername)
       irc_send("PRIVMSG %s :CHECK -> No such scanner '%s', or '%s' has 0 protocols.",
@@ -947,6 +1154,8 @@ scan_manual(char *param, const char *target)
              ss->manual_target, ss->ip);
     scan_free(ss);
   }
+  else
+    scan_checkfinished(ss);  /* All DNSBL answers may have been cached */
 }
 
 /* scan_log
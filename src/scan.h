@@ -30,6 +30,7 @@ struct scan_struct
   char *irc_hostname;
 
   char *ip;
+  OPM_ADDR_T addr;  /* ip in binary form, parsed once when the scan is created */
   char *proof;
   OPM_REMOTE_T *remote;
 
@@ -43,7 +44,7 @@ struct scanner_struct
 {
   char *name;
   OPM_T *scanner;
-  list_t *masks;
+  struct mask_index *masks;
 };
 
 struct protocol_assoc
@@ -59,5 +60,6 @@ extern void scan_connect(const char *[], const char *);
 extern void scan_checkfinished(struct scan_struct *);
 extern void scan_manual(char *, const char *);
 extern void scan_timer(void);
+extern void scan_fdstats(const char *);
 extern void scan_positive(struct scan_struct *, const char *, const char *);
 #endif /* SCAN_H */
@@ -34,6 +34,9 @@
 #include "misc.h"
 #include "config.h"
 #include "stats.h"
+#include "scan.h"
+#include "firedns.h"
+#include "negcache.h"
 #include "libopm/src/opm_types.h"
 
 static time_t STATS_UPTIME;
@@ -162,6 +165,23 @@ stats_output(const char *target)
     if (bl->stats_recv > 0)
       irc_send("PRIVMSG %s :DNSBL: %u successful lookups from %s",
                target, bl->stats_recv, bl->name);
+
+    if (bl->stats_cache_hit + bl->stats_cache_miss > 0)
+      irc_send("PRIVMSG %s :DNSBL: %u cache hits, %u misses, %u cached answers for %s",
+               target, bl->stats_cache_hit, bl->stats_cache_miss,
+               LIST_SIZE(&bl->cache_list), bl->name);
+  }
+
+  if (OptionsItem->negcache)
+  {
+    struct negcache_stats st;
+
+    negcache_get_stats(&st);
+
+    irc_send("PRIVMSG %s :Negative cache: %zu entries, IPv4 /%d: %u hits, %u misses (%.1f%%), "
+             "IPv6 /%d: %u hits, %u misses (%.1f%%)", target, st.entries,
+             st.prefix4, st.hit4, st.miss4, st.hit4 ? 100.0 * st.hit4 / (st.hit4 + st.miss4) : 0.0,
+             st.prefix6, st.hit6, st.miss6, st.hit6 ? 100.0 * st.hit6 / (st.hit6 + st.miss6) : 0.0);
   }
 
   if (STATS_DNSBLSENT > 0)
@@ -245,4 +265,32 @@ fdstats_output(const char *target)
   }
 
   irc_send("PRIVMSG %s :Total open FD: %u/%d", target, total_fd_use, rlim.rlim_cur);
+
+  scan_fdstats(target);
+}
+
+/* dnsstats_output
+ *
+ *    Output how each nameserver has been answering to target via
+ *    privmsg.
+ *
+ * Parameters:
+ *    target: Channel to send the stats to
+ *
+ * Return: NONE
+ */
+void
+dnsstats_output(const char *target)
+{
+  struct firedns_server_stats st;
+  unsigned int i;
+
+  for (i = 0; firedns_server_stats(i, &st) == 0; ++i)
+    irc_send("PRIVMSG %s :DNS server %s: rtt %ums (+/- %ums), loss %u.%u%%, "
+             "%u sent, %u answered, %u lost, %u hedged, %u over TCP", target,
+             st.addr, st.srtt, st.rttvar, st.loss / 10, st.loss % 10,
+             st.sent, st.answered, st.lost, st.hedged, st.tcp);
+
+  if (i == 0)
+    irc_send("PRIVMSG %s :No DNS servers configured", target);
 }
@@ -35,5 +35,6 @@ extern void stats_dnsblrecv(struct BlacklistConf *);
 extern void stats_dnsblsend(void);
 extern void stats_output(const char *);
 extern void fdstats_output(const char *);
+extern void dnsstats_output(const char *);
 
 #endif /* STATS_H */